@@ -58,8 +58,18 @@ int main() {
         auto stream_params = MessageSendParams::create()
             .with_message(stream_message);
         
-        client.send_message_streaming(stream_params, [](const std::string& event) {
-            std::cout << "   Event: " << event << std::endl;
+        client.send_message_streaming(stream_params, [](const StreamEvent& event) {
+            if (event.is_message()) {
+                std::cout << "   Message: " << event.as_message().get_text() << std::endl;
+            } else if (event.is_task()) {
+                std::cout << "   Task: " << event.as_task().id() << std::endl;
+            } else if (event.is_status_update()) {
+                std::cout << "   Status: "
+                         << to_string(event.as_status_update().status().state()) << std::endl;
+            } else {
+                std::cout << "   Artifact: "
+                         << event.as_artifact_update().artifact().id() << std::endl;
+            }
         });
         
         std::cout << std::endl;
@@ -252,10 +252,30 @@ void test_special_characters() {
     std::cout << "✓ 测试通过\n" << std::endl;
 }
 
+void test_response_view() {
+    std::cout << "=== 测试 11: 零拷贝响应视图 ===" << std::endl;
+    
+    std::string json = R"({"jsonrpc":"2.0","id":42,"result":{"id":"task-1","items":[1,2,3]}})";
+    
+    JsonRpcResponseView view = JsonRpcResponseView::parse(json);
+    
+    std::cout << "  id: " << view.id() << std::endl;
+    std::cout << "  result: " << *view.result() << std::endl;
+    
+    assert(view.is_success());
+    assert(view.id() == "42");
+    assert(*view.result() == R"({"id":"task-1","items":[1,2,3]})");
+    // result 直接指向原始缓冲区，没有拷贝
+    assert(view.result()->data() >= json.data() &&
+           view.result()->data() < json.data() + json.size());
+    
+    std::cout << "✓ 测试通过\n" << std::endl;
+}
+
 int main() {
     std::cout << "╔══════════════════════════════════════════╗" << std::endl;
     std::cout << "║  A2A C++ SDK - JSON-RPC 功能验证测试     ║" << std::endl;
-    std::cout << "║  使用 nlohmann::json 库                  ║" << std::endl;
+    std::cout << "║  使用单遍 JSON 读写器                    ║" << std::endl;
     std::cout << "╚══════════════════════════════════════════╝" << std::endl;
     std::cout << std::endl;
     
@@ -270,6 +290,7 @@ int main() {
         test_complex_nested_json();
         test_error_handling();
         test_special_characters();
+        test_response_view();
         
         std::cout << "╔══════════════════════════════════════════╗" << std::endl;
         std::cout << "║  ✓ 所有测试通过！                       ║" << std::endl;
@@ -1,4 +1,4 @@
-#include "redis_task_store.hpp"
+#include <a2a/server/redis_task_store.hpp>
 #include "qwen_client.hpp"
 #include "http_server.hpp"
 #include <a2a/models/agent_message.hpp>
@@ -117,7 +117,7 @@ private:
                 // 获取文本内容
                 std::string user_text;
                 if (!message.parts().empty()) {
-                    auto text_part = dynamic_cast<TextPart*>(message.parts()[0].get());
+                    auto text_part = message.parts()[0].get_if<TextPart>();
                     if (text_part) {
                         user_text = text_part->text();
                     }
@@ -225,7 +225,7 @@ private:
             std::string role_str = to_string(msg.role());
             std::string text;
             if (!msg.parts().empty()) {
-                auto text_part = dynamic_cast<TextPart*>(msg.parts()[0].get());
+                auto text_part = msg.parts()[0].get_if<TextPart>();
                 if (text_part) {
                     text = text_part->text();
                 }
@@ -2,7 +2,7 @@
 #include <a2a/core/exception.hpp>
 #include <a2a/core/jsonrpc_request.hpp>
 #include <a2a/core/jsonrpc_response.hpp>
-#include "redis_task_store.hpp"
+#include <a2a/server/redis_task_store.hpp>
 #include "qwen_client.hpp"
 #include "http_server.hpp"
 #include <iostream>
@@ -87,7 +87,8 @@ private:
                 
                 auto task_store = task_manager_.get_task_store();
                 if (task_store) {
-                    auto history = task_store->get_history(context_id, history_length);
+                    // 只取最近 history_length 条，共享而不复制消息
+                    auto history = task_store->get_history_tail(context_id, history_length);
                     
                     if (!history.empty()) {
                         std::cout << "[Math Agent] 从 Redis TaskStore 获取到 " 
@@ -95,10 +96,10 @@ private:
                         
                         std::string history_text = "对话历史：\n";
                         for (const auto& hist_msg : history) {
-                            if (hist_msg.role() == MessageRole::User) {
-                                history_text += "用户: " + hist_msg.get_text() + "\n";
+                            if (hist_msg->role() == MessageRole::User) {
+                                history_text += "用户: " + hist_msg->get_text() + "\n";
                             } else {
-                                history_text += "助手: " + hist_msg.get_text() + "\n";
+                                history_text += "助手: " + hist_msg->get_text() + "\n";
                             }
                         }
                         
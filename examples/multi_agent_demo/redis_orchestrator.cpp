@@ -3,7 +3,8 @@
 #include <a2a/core/exception.hpp>
 #include <a2a/core/jsonrpc_request.hpp>
 #include <a2a/core/jsonrpc_response.hpp>
-#include "redis_task_store.hpp"
+#include <a2a/server/redis_task_store.hpp>
+#include <a2a/server/caching_task_store.hpp>
 #include "qwen_client.hpp"
 #include "http_server.hpp"
 #include <iostream>
@@ -258,11 +259,24 @@ int main(int argc, char* argv[]) {
             redis_port = std::stoi(argv[3]);
         }
         
-        // ✅ 创建 Redis TaskStore
-        auto redis_task_store = std::make_shared<RedisTaskStore>(redis_host, redis_port);
+        // ✅ 创建 Redis TaskStore（发布变更，供其他进程的缓存失效）
+        RedisTaskStoreOptions redis_options;
+        redis_options.host = redis_host;
+        redis_options.port = redis_port;
+        redis_options.publish_changes = true;
+        auto redis_task_store = std::make_shared<RedisTaskStore>(redis_options);
         std::cout << "[Main] 创建 Redis TaskStore: " << redis_host << ":" << redis_port << std::endl;
         
-        RedisOrchestrator agent(api_key, redis_task_store, port);
+        // ✅ 进程内缓存：热点上下文直接从内存读取，其他进程写入时失效
+        auto task_store = std::make_shared<CachingTaskStore>(redis_task_store);
+        redis_task_store->subscribe_changes(
+            [weak = std::weak_ptr<CachingTaskStore>(task_store)](const std::string& task_id) {
+                if (auto cache = weak.lock()) {
+                    task_id.empty() ? cache->clear() : cache->invalidate(task_id);
+                }
+            });
+        
+        RedisOrchestrator agent(api_key, task_store, port);
         agent.start();
         
     } catch (const std::exception& e) {
@@ -75,7 +75,7 @@ echo "  tail -f logs/redis_math_agent.log"
 echo ""
 echo "查看 Redis 数据:"
 echo "  redis-cli KEYS 'a2a:*'"
-echo "  redis-cli LRANGE 'a2a:history:ctx-123' 0 -1"
+echo "  redis-cli LRANGE 'a2a:task:{ctx-123}:history' 0 -1"
 echo ""
 echo "停止服务:"
 echo "  pkill -f redis_orchestrator"
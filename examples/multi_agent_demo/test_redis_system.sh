@@ -35,14 +35,14 @@ sleep 2
 # 检查 Redis 中的数据
 echo "检查 Redis 中的历史数据:"
 echo "----------------------------------------"
-HISTORY_COUNT=$(redis-cli LLEN "a2a:history:$CONTEXT_ID")
+HISTORY_COUNT=$(redis-cli LLEN "a2a:task:{$CONTEXT_ID}:history")
 echo "历史消息数量: $HISTORY_COUNT"
 
 if [ "$HISTORY_COUNT" -gt 0 ]; then
     echo "✅ Orchestrator 成功保存历史到 Redis"
     echo ""
     echo "历史内容:"
-    redis-cli LRANGE "a2a:history:$CONTEXT_ID" 0 -1 | head -20
+    redis-cli LRANGE "a2a:task:{$CONTEXT_ID}:history" 0 -1 | head -20
 else
     echo "❌ Redis 中没有历史数据"
 fi
@@ -76,7 +76,7 @@ sleep 2
 # 再次检查 Redis
 echo "再次检查 Redis 中的历史数据:"
 echo "----------------------------------------"
-HISTORY_COUNT=$(redis-cli LLEN "a2a:history:$CONTEXT_ID")
+HISTORY_COUNT=$(redis-cli LLEN "a2a:task:{$CONTEXT_ID}:history")
 echo "历史消息数量: $HISTORY_COUNT"
 echo ""
 
@@ -123,14 +123,14 @@ echo "----------------------------------------"
 echo "所有 A2A 相关的 Key:"
 redis-cli KEYS "a2a:*"
 echo ""
-echo "历史消息数量: $(redis-cli LLEN "a2a:history:$CONTEXT_ID")"
+echo "历史消息数量: $(redis-cli LLEN "a2a:task:{$CONTEXT_ID}:history")"
 echo ""
 
 # 验证总结
 echo "=== 测试总结 ==="
 echo ""
 
-FINAL_COUNT=$(redis-cli LLEN "a2a:history:$CONTEXT_ID")
+FINAL_COUNT=$(redis-cli LLEN "a2a:task:{$CONTEXT_ID}:history")
 if [ "$FINAL_COUNT" -ge 6 ]; then
     echo "✅ 测试通过！"
     echo "   - Orchestrator 成功保存历史到 Redis"
@@ -4,10 +4,14 @@
 #include "../models/agent_message.hpp"
 #include "../models/message_send_params.hpp"
 #include "../models/a2a_response.hpp"
+#include "../models/stream_event.hpp"
 #include "../core/http_client.hpp"
+#include "../core/wire_format.hpp"
 #include <string>
 #include <memory>
 #include <functional>
+#include <future>
+#include <vector>
 
 namespace a2a {
 
@@ -16,6 +20,11 @@ namespace a2a {
  */
 class A2AClient {
 public:
+    /**
+     * @brief Receives each parsed event of a streaming request
+     */
+    using StreamEventCallback = std::function<void(const StreamEvent&)>;
+    
     /**
      * @brief Construct client with agent base URL
      * @param base_url Base URL of the agent service
@@ -38,15 +47,35 @@ public:
      */
     A2AResponse send_message(const MessageSendParams& params);
     
+    /**
+     * @brief Send a non-streaming message request without blocking
+     *
+     * Many requests may be in flight at once; they share pooled (and, over
+     * HTTP/2, multiplexed) connections.
+     * @param params Message parameters
+     * @return Future yielding the response or rethrowing A2AException
+     */
+    std::future<A2AResponse> send_message_async(const MessageSendParams& params);
+    
     /**
      * @brief Send a streaming message request
      * @param params Message parameters
-     * @param callback Called for each event received (Task, Message, or status update)
+     * @param callback Called with the JSON-RPC response carried by each
+     *        Server-Sent Event, reassembled across network reads
      * @throws A2AException on error
      */
     void send_message_streaming(const MessageSendParams& params,
                                std::function<void(const std::string&)> callback);
     
+    /**
+     * @brief Send a streaming message request, receiving typed events
+     * @param params Message parameters
+     * @param callback Called for each Task, Message, status or artifact update
+     * @throws A2AException on error, including a JSON-RPC error event
+     */
+    void send_message_streaming(const MessageSendParams& params,
+                               const StreamEventCallback& callback);
+    
     /**
      * @brief Get a task by ID
      * @param task_id Task identifier
@@ -55,6 +84,14 @@ public:
      */
     AgentTask get_task(const std::string& task_id);
     
+    /**
+     * @brief Get several tasks in one JSON-RPC batch round-trip
+     * @param task_ids Task identifiers
+     * @return Tasks in the same order as task_ids
+     * @throws A2AException if any task cannot be retrieved
+     */
+    std::vector<AgentTask> get_tasks(const std::vector<std::string>& task_ids);
+    
     /**
      * @brief Cancel a task
      * @param task_id Task identifier
@@ -72,11 +109,28 @@ public:
     void subscribe_to_task(const std::string& task_id,
                           std::function<void(const std::string&)> callback);
     
+    /**
+     * @brief Subscribe to task updates, receiving typed events
+     * @param task_id Task identifier
+     * @param callback Called for each event received
+     * @throws A2AException on error, including a JSON-RPC error event
+     */
+    void subscribe_to_task(const std::string& task_id,
+                          const StreamEventCallback& callback);
+    
     /**
      * @brief Set request timeout
      * @param seconds Timeout in seconds
      */
     void set_timeout(long seconds);
+    
+    /**
+     * @brief Encoding for non-streaming requests (default WireFormat::Json)
+     *
+     * With WireFormat::Cbor, params are encoded as CBOR and the server
+     * answers in kind; streaming requests are always sent as JSON.
+     */
+    void set_wire_format(WireFormat format);
 
 private:
     class Impl;
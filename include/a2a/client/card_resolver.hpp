@@ -2,13 +2,21 @@
 
 #include "../models/agent_card.hpp"
 #include "../core/http_client.hpp"
+#include <chrono>
 #include <string>
 #include <memory>
+#include <optional>
 
 namespace a2a {
 
 /**
  * @brief Resolves Agent Card information from an A2A-compatible endpoint
+ *
+ * The fetched card is cached. While it is fresh (per the server's
+ * Cache-Control max-age, or set_cache_ttl()) get_agent_card() returns it
+ * without a request; after that it revalidates with If-None-Match, and a
+ * 304 Not Modified reuses the parsed card. Thread-safe; concurrent calls
+ * share one fetch.
  */
 class A2ACardResolver {
 public:
@@ -35,6 +43,18 @@ public:
      */
     AgentCard get_agent_card();
     
+    /**
+     * @brief Override how long a fetched card is used without asking the server
+     * @param ttl Freshness lifetime (zero revalidates on every call);
+     *            std::nullopt follows the server's Cache-Control again
+     */
+    void set_cache_ttl(std::optional<std::chrono::seconds> ttl);
+    
+    /**
+     * @brief Drop the cached card; the next call fetches it in full
+     */
+    void invalidate();
+    
     /**
      * @brief Get the full agent card URL
      */
@@ -1,9 +1,27 @@
 #pragma once
 
+#include "static_string_map.hpp"
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace a2a {
 
+/**
+ * @brief A2A JSON-RPC methods, for switching on a parsed method name
+ */
+enum class A2AMethod {
+    MessageSend,
+    MessageStream,
+    TaskGet,
+    TaskCancel,
+    TaskResubscribe,
+    TaskPushNotificationConfigSet,
+    TaskPushNotificationConfigGet
+};
+
+constexpr size_t A2A_METHOD_COUNT = 7;
+
 /**
  * @brief Constants for A2A JSON-RPC method names
  */
@@ -24,25 +42,54 @@ public:
     static constexpr const char* TASK_PUSH_NOTIFICATION_CONFIG_GET = 
         "tasks/pushNotificationConfig/get";
     
+    /**
+     * @brief Method named by a string (one hash, no allocation)
+     * @return std::nullopt for names outside the A2A protocol
+     */
+    static constexpr std::optional<A2AMethod> parse(std::string_view method);
+    
+    /**
+     * @brief Wire name of a method
+     */
+    static constexpr std::string_view name(A2AMethod method);
+    
     /**
      * @brief Check if a method requires streaming response
      */
-    static bool is_streaming_method(const std::string& method) {
-        return method == MESSAGE_STREAM || method == TASK_SUBSCRIBE;
+    static constexpr bool is_streaming_method(std::string_view method) {
+        std::optional<A2AMethod> parsed = parse(method);
+        return parsed == A2AMethod::MessageStream || parsed == A2AMethod::TaskResubscribe;
     }
     
     /**
      * @brief Check if a method name is valid
      */
-    static bool is_valid_method(const std::string& method) {
-        return method == MESSAGE_SEND ||
-               method == MESSAGE_STREAM ||
-               method == TASK_GET ||
-               method == TASK_CANCEL ||
-               method == TASK_SUBSCRIBE ||
-               method == TASK_PUSH_NOTIFICATION_CONFIG_SET ||
-               method == TASK_PUSH_NOTIFICATION_CONFIG_GET;
+    static constexpr bool is_valid_method(std::string_view method) {
+        return parse(method).has_value();
     }
 };
 
+namespace detail {
+
+inline constexpr StaticStringMap<A2AMethod, A2A_METHOD_COUNT> A2A_METHOD_NAMES({{
+    {A2AMethods::MESSAGE_SEND, A2AMethod::MessageSend},
+    {A2AMethods::MESSAGE_STREAM, A2AMethod::MessageStream},
+    {A2AMethods::TASK_GET, A2AMethod::TaskGet},
+    {A2AMethods::TASK_CANCEL, A2AMethod::TaskCancel},
+    {A2AMethods::TASK_SUBSCRIBE, A2AMethod::TaskResubscribe},
+    {A2AMethods::TASK_PUSH_NOTIFICATION_CONFIG_SET, A2AMethod::TaskPushNotificationConfigSet},
+    {A2AMethods::TASK_PUSH_NOTIFICATION_CONFIG_GET, A2AMethod::TaskPushNotificationConfigGet},
+}});
+
+} // namespace detail
+
+constexpr std::optional<A2AMethod> A2AMethods::parse(std::string_view method) {
+    return detail::A2A_METHOD_NAMES.find(method);
+}
+
+constexpr std::string_view A2AMethods::name(A2AMethod method) {
+    // Entries are listed in enumerator order
+    return detail::A2A_METHOD_NAMES.entries()[static_cast<size_t>(method)].first;
+}
+
 } // namespace a2a
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace a2a {
+
+/**
+ * @brief Length of the padded base64 encoding of @p size bytes
+ */
+constexpr size_t base64_encoded_size(size_t size) {
+    return (size + 2) / 3 * 4;
+}
+
+/**
+ * @brief Upper bound on the bytes decoded from @p length base64 characters
+ */
+constexpr size_t base64_decoded_capacity(size_t length) {
+    return (length + 3) / 4 * 3;
+}
+
+/**
+ * @brief Encode into a caller-provided buffer
+ *
+ * Writes exactly base64_encoded_size(size) characters to @p out, padded
+ * with '='. Uses AVX2 or SSSE3 when the CPU supports them.
+ */
+void base64_encode(const uint8_t* data, size_t size, char* out);
+
+std::string base64_encode(const std::vector<uint8_t>& data);
+
+/**
+ * @brief Decode into a caller-provided buffer
+ *
+ * @p out must hold base64_decoded_capacity(text.size()) bytes. Padding
+ * is optional and whitespace (as in line-wrapped MIME output) is skipped.
+ * @return Number of bytes written
+ * @throws A2AException with ErrorCode::ParseError on malformed input
+ */
+size_t base64_decode(std::string_view text, uint8_t* out);
+
+std::vector<uint8_t> base64_decode(std::string_view text);
+
+} // namespace a2a
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace a2a {
+
+/**
+ * @brief Default gzip level: fast, and most of the gain on JSON text
+ */
+constexpr int DEFAULT_COMPRESSION_LEVEL = 1;
+
+/**
+ * @brief Reusable gzip (RFC 1952) compressor
+ *
+ * The deflate state (about 256 KiB) is allocated once and reset between
+ * bodies, so compressing many small responses does not pay for it each
+ * time. Not thread-safe; keep one per thread or per stream.
+ */
+class GzipCompressor {
+public:
+    GzipCompressor();
+    ~GzipCompressor();
+    
+    GzipCompressor(const GzipCompressor&) = delete;
+    GzipCompressor& operator=(const GzipCompressor&) = delete;
+    
+    /**
+     * @brief Start a new gzip member
+     * @param level 1 (fastest) to 9 (smallest)
+     */
+    void reset(int level = DEFAULT_COMPRESSION_LEVEL);
+    
+    /**
+     * @brief Append the compressed form of @p data to @p out
+     *
+     * The output is flushed to a byte boundary, so everything written so
+     * far can be decoded by the peer before the member ends (as needed for
+     * Server-Sent Events).
+     */
+    void write(std::string_view data, std::string& out);
+    
+    /**
+     * @brief Append the end of the member (trailer) to @p out
+     */
+    void finish(std::string& out);
+    
+    /**
+     * @brief Append a complete gzip member holding @p data to @p out
+     */
+    void compress(std::string_view data, int level, std::string& out);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief Compress a whole body with a compressor kept per calling thread
+ */
+std::string gzip_compress(std::string_view data, int level = DEFAULT_COMPRESSION_LEVEL);
+
+/**
+ * @brief Decompress a gzip body (one or more members) into @p out
+ * @return false if the output would exceed @p max_size
+ * @throws A2AException with ErrorCode::ParseError on malformed input
+ */
+bool gzip_decompress(std::string_view data, std::string& out, size_t max_size);
+
+/**
+ * @brief Whether an Accept-Encoding header value allows gzip
+ *
+ * Honours "gzip", "x-gzip" and "*", and a q=0 that refuses them.
+ */
+bool accepts_gzip(std::string_view accept_encoding);
+
+} // namespace a2a
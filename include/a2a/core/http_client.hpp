@@ -1,9 +1,13 @@
 #pragma once
 
+#include "compression.hpp"
 #include <string>
+#include <string_view>
 #include <map>
 #include <memory>
 #include <functional>
+#include <future>
+#include <exception>
 
 namespace a2a {
 
@@ -13,6 +17,9 @@ namespace a2a {
 struct HttpResponse {
     int status_code;
     std::string body;
+    
+    /// HttpClient fills in "content-type", "etag" and "cache-control"
+    /// (lower-cased) when the server sent them
     std::map<std::string, std::string> headers;
     
     bool is_success() const {
@@ -20,12 +27,62 @@ struct HttpResponse {
     }
 };
 
+/**
+ * @brief Connection reuse settings for HttpClient
+ */
+struct HttpClientOptions {
+    /// Maximum idle connections kept open in the shared connection cache
+    long max_idle_connections = 16;
+    
+    /// Maximum idle easy handles kept for reuse
+    size_t max_idle_handles = 8;
+    
+    /// Enable TCP keep-alive probes on pooled connections
+    bool keep_alive = true;
+    long keep_alive_idle_seconds = 60;
+    long keep_alive_interval_seconds = 30;
+    
+    /// Idle connections and handles older than this are closed instead of reused
+    long idle_timeout_seconds = 118;
+    
+    /// Maximum parallel connections per host for async requests (0 = unlimited)
+    long max_host_connections = 0;
+    
+    /// Advertise every content coding libcurl supports and decode responses
+    bool accept_compressed = true;
+    
+    /// Gzip request bodies at least this large (0 = never); only for servers
+    /// that accept Content-Encoding: gzip, such as HttpServer
+    size_t request_compression_min_bytes = 0;
+    int compression_level = DEFAULT_COMPRESSION_LEVEL;
+};
+
 /**
  * @brief HTTP Client wrapper (uses libcurl internally)
+ *
+ * Requests reuse pooled easy handles that share one connection, DNS and
+ * TLS session cache, so consecutive calls to the same host skip the TCP
+ * and TLS handshakes. Requests may be issued from multiple threads once
+ * timeout and headers have been configured.
+ *
+ * Async requests are driven by a single event-loop thread on curl_multi
+ * (started on first use) and are multiplexed over HTTP/2 when the server
+ * negotiates it.
+ *
+ * Compressed responses (including event streams) are decoded as they
+ * arrive, so callers always see the identity body.
  */
 class HttpClient {
 public:
+    /**
+     * @brief Completion callback for async requests
+     * Runs on the event-loop thread; error is set if the transfer failed,
+     * in which case response is empty.
+     */
+    using CompletionCallback = std::function<void(HttpResponse response, std::exception_ptr error)>;
+    
     HttpClient();
+    explicit HttpClient(const HttpClientOptions& options);
     ~HttpClient();
     
     // Disable copy, enable move
@@ -39,6 +96,12 @@ public:
      */
     HttpResponse get(const std::string& url);
     
+    /**
+     * @brief Perform GET request with extra headers for this request only
+     * (e.g. If-None-Match)
+     */
+    HttpResponse get(const std::string& url, const std::map<std::string, std::string>& headers);
+    
     /**
      * @brief Perform POST request
      */
@@ -55,6 +118,38 @@ public:
                     const std::string& content_type,
                     std::function<void(const std::string&)> callback);
     
+    /**
+     * @brief Receives response bytes as they arrive
+     * The view points into libcurl's buffer and is valid only during the call.
+     */
+    using ChunkCallback = std::function<void(std::string_view chunk)>;
+    
+    /**
+     * @brief Perform POST request with streaming response, without copying chunks
+     * An exception thrown by the callback aborts the transfer and is rethrown.
+     */
+    void post_stream_chunks(const std::string& url,
+                            const std::string& body,
+                            const std::string& content_type,
+                            const ChunkCallback& callback);
+    
+    /**
+     * @brief Perform POST request without blocking
+     * @return Future that yields the response or rethrows A2AException
+     */
+    std::future<HttpResponse> post_async(const std::string& url,
+                                         std::string body,
+                                         const std::string& content_type = "application/json");
+    
+    /**
+     * @brief Perform POST request without blocking
+     * @param on_complete Invoked on the event-loop thread when the transfer ends
+     */
+    void post_async(const std::string& url,
+                    std::string body,
+                    const std::string& content_type,
+                    CompletionCallback on_complete);
+    
     /**
      * @brief Set request timeout in seconds
      */
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace a2a {
+
+/**
+ * @brief 128-bit identifier in UUID byte order
+ */
+using Uuid = std::array<uint8_t, 16>;
+
+/**
+ * @brief Length of the canonical text form (8-4-4-4-12 hex digits)
+ */
+constexpr size_t UUID_TEXT_LENGTH = 36;
+
+/**
+ * @brief Generate a time-ordered UUID (version 7, RFC 9562)
+ *
+ * The first 48 bits are the Unix time in milliseconds, so ids sort by
+ * creation time both as bytes and as text. Within a process every id is
+ * distinct: the rest of the value holds a sequence number drawn from
+ * blocks each thread reserves with a single atomic add, followed by random
+ * bits that keep ids from different processes apart. Ids from one thread
+ * are strictly increasing. Lock-free and safe to call from any thread.
+ */
+Uuid generate_uuid_v7();
+
+/**
+ * @brief Write the lowercase canonical text form to @p out
+ *
+ * Writes exactly UUID_TEXT_LENGTH characters, without a terminator.
+ */
+void format_uuid(const Uuid& uuid, char* out);
+
+/**
+ * @brief Generate an id for a task, context, message or request
+ * @return A new UUIDv7 in canonical text form
+ */
+std::string generate_id();
+
+} // namespace a2a
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <vector>
+#include "wire_format.hpp"
+
+namespace a2a {
+
+/**
+ * @brief Single-pass pull tokenizer over a JSON document
+ *
+ * The reader walks the input once, left to right, without building a tree.
+ * Callers drive it from the schema they expect:
+ *
+ * @code
+ *   reader.begin_object();
+ *   std::string_view key;
+ *   while (reader.next_key(key)) {
+ *       if (key == "id") id = reader.read_string();
+ *       else reader.skip_value();
+ *   }
+ * @endcode
+ *
+ * The input is not copied and must outlive the reader.
+ * Malformed input throws A2AException with ErrorCode::ParseError.
+ *
+ * Constructed with WireFormat::Cbor it reads CBOR through the same calls.
+ * Maps and arrays may be definite or indefinite length, tags are skipped
+ * and map keys must be text strings.
+ */
+class JsonReader {
+public:
+    enum class Type {
+        Null,
+        Boolean,
+        Number,
+        String,
+        Object,
+        Array,
+        Bytes  ///< Byte string (CBOR only)
+    };
+    
+    explicit JsonReader(std::string_view input, WireFormat format = WireFormat::Json)
+        : in_(input), cbor_(format == WireFormat::Cbor) {}
+    
+    WireFormat format() const { return cbor_ ? WireFormat::Cbor : WireFormat::Json; }
+    
+    /**
+     * @brief Type of the next value (does not consume it)
+     */
+    Type peek();
+    
+    /**
+     * @brief Consume '{'
+     */
+    void begin_object();
+    
+    /**
+     * @brief Advance to the next member of the current object
+     * @param key Set to the member name (valid until the next reader call)
+     * @return false once the closing '}' has been consumed
+     */
+    bool next_key(std::string_view& key);
+    
+    /**
+     * @brief Consume '['
+     */
+    void begin_array();
+    
+    /**
+     * @brief Advance to the next element of the current array
+     * @return false once the closing ']' has been consumed
+     */
+    bool next_element();
+    
+    /**
+     * @brief Read a string value, decoding escape sequences
+     */
+    std::string read_string();
+    
+    /**
+     * @brief Read a string value without allocating when possible
+     *
+     * Points into the input if the string has no escapes, otherwise into an
+     * internal scratch buffer that is overwritten by the next read.
+     */
+    std::string_view read_string_view();
+    
+    int64_t read_int();
+    
+    /**
+     * @brief Whether the next value is a number without fraction or exponent
+     */
+    bool peek_integer();
+    
+    double read_double();
+    bool read_bool();
+    
+    /**
+     * @brief Read binary data: base64 text in JSON, a byte string in CBOR
+     */
+    std::vector<uint8_t> read_bytes();
+    
+    /**
+     * @brief Consume a null literal if it is the next value
+     * @return true if a null was consumed
+     */
+    bool consume_null();
+    
+    /**
+     * @brief Skip the next value and return its exact source text
+     *
+     * The text is in the reader's format; see read_json_text().
+     */
+    std::string_view read_raw();
+    
+    /**
+     * @brief Read the next value as JSON text
+     *
+     * For members a model keeps as JSON text. Returns the source text when
+     * reading JSON; CBOR is transcoded into a buffer that is overwritten
+     * by the next call.
+     */
+    std::string_view read_json_text();
+    
+    /**
+     * @brief Skip the next value (of any type)
+     */
+    void skip_value();
+    
+    /**
+     * @brief Offset in the input where the next value starts
+     *
+     * With span_from(), captures the source text of a value while reading
+     * it, where read_raw() would take a separate pass.
+     */
+    size_t mark();
+    
+    /**
+     * @brief Source text from a mark() up to the current position
+     */
+    std::string_view span_from(size_t mark) const { return in_.substr(mark, pos_ - mark); }
+    
+    /**
+     * @brief Read an object into a string map
+     *
+     * Every member value must be a string: a map of strings could not
+     * write another type back unchanged, so other values throw
+     * A2AException with ErrorCode::InvalidParams.
+     */
+    template <typename Map>
+    void read_string_map(Map& out) {
+        begin_object();
+        std::string_view name;
+        while (next_key(name)) {
+            if (peek() != Type::String) {
+                fail_not_string(name);
+            }
+            out[std::string(name)] = read_string();
+        }
+    }
+    
+    /**
+     * @brief Read an array of strings, appending to a container
+     */
+    template <typename Sequence>
+    void read_string_array(Sequence& out) {
+        begin_array();
+        while (next_element()) {
+            out.push_back(read_string());
+        }
+    }
+    
+    /**
+     * @brief Current byte offset into the input
+     */
+    size_t position() const { return pos_; }
+    
+    /**
+     * @brief The whole input being read
+     */
+    std::string_view input() const { return in_; }
+
+private:
+    [[noreturn]] void fail(const char* what) const;
+    [[noreturn]] void fail_not_string(std::string_view name) const;
+    
+    void skip_whitespace();
+    void expect(char c);
+    void expect_literal(std::string_view literal);
+    std::string_view scan_string(bool& has_escapes);
+    void decode_string(std::string_view raw, std::string& out) const;
+    void skip_number();
+    void json_skip_value(size_t depth);
+    
+    // CBOR counterparts of the public calls
+    struct CborHead {
+        uint8_t major;
+        uint64_t argument;
+        bool indefinite;
+    };
+    CborHead cbor_head();
+    uint8_t cbor_peek_byte();
+    void cbor_skip_tags();
+    Type cbor_peek();
+    void cbor_begin(uint8_t major);
+    bool cbor_next();
+    std::string_view cbor_read_string(uint8_t major);
+    int64_t cbor_read_int();
+    double cbor_read_double();
+    void cbor_skip_value(size_t depth);
+    
+    std::string_view in_;
+    size_t pos_ = 0;
+    bool cbor_;
+    bool first_ = true;
+    std::string scratch_;
+    std::string transcoded_;
+    
+    // Items left in each open CBOR map or array (key and value count
+    // separately); CBOR_INDEFINITE until a break byte
+    std::vector<uint64_t> containers_;
+};
+
+} // namespace a2a
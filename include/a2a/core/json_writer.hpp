@@ -0,0 +1,182 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include "wire_format.hpp"
+
+namespace a2a {
+
+/**
+ * @brief Append-only JSON writer
+ *
+ * Emits tokens directly into a caller-owned buffer and inserts separators
+ * automatically. The buffer is only ever appended to, so a single string
+ * can be cleared and reused across many documents.
+ *
+ * Constructed with WireFormat::Cbor it emits the same calls as CBOR
+ * instead: objects and arrays become indefinite-length maps and arrays,
+ * and bytes() writes a byte string rather than base64 text.
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out, WireFormat format = WireFormat::Json)
+        : out_(out), cbor_(format == WireFormat::Cbor) {}
+    
+    // Non-copyable (holds a reference to the output buffer)
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+    
+    WireFormat format() const { return cbor_ ? WireFormat::Cbor : WireFormat::Json; }
+    
+    void begin_object() { separate(); out_.push_back(cbor_ ? '\xBF' : '{'); need_comma_ = false; }
+    void end_object() { out_.push_back(cbor_ ? '\xFF' : '}'); need_comma_ = true; }
+    void begin_array() { separate(); out_.push_back(cbor_ ? '\x9F' : '['); need_comma_ = false; }
+    void end_array() { out_.push_back(cbor_ ? '\xFF' : ']'); need_comma_ = true; }
+    
+    /**
+     * @brief Write an object key; the next call must write its value
+     */
+    void key(std::string_view name);
+    
+    /**
+     * @brief Write an escaped string value
+     */
+    void string(std::string_view value);
+    
+    void integer(int64_t value);
+    
+    /**
+     * @brief Write a floating-point number (null if not finite in JSON)
+     */
+    void floating(double value);
+    
+    void boolean(bool value);
+    void null();
+    
+    /**
+     * @brief Write binary data: base64 text in JSON, a byte string in CBOR
+     */
+    void bytes(const uint8_t* data, size_t size);
+    
+    /**
+     * @brief Splice an already serialized value verbatim
+     *
+     * The fragment must be in this writer's format; an empty one is
+     * written as null.
+     */
+    void raw(std::string_view fragment);
+    
+    /**
+     * @brief Write a value given as JSON text, transcoding it for CBOR
+     *
+     * For members a model keeps as JSON text (DataPart data, JSON-RPC
+     * params and results). An empty fragment is written as null.
+     * @throws A2AException with ErrorCode::ParseError if CBOR output is
+     *         requested and the fragment is not valid JSON
+     */
+    void json_text(std::string_view fragment);
+    
+    /**
+     * @brief Write a string value that is known to need no escaping
+     *
+     * Reserves @p length characters between the quotes and passes a
+     * pointer to them to @p fill, which must write every one. Lets large
+     * payloads such as base64 be encoded straight into the output.
+     */
+    template <typename Fill>
+    void unescaped_string(size_t length, Fill&& fill) {
+        fill(reserve_string(length));
+        need_comma_ = true;
+    }
+    
+    /**
+     * @brief Shortcuts for writing a key followed by its value
+     */
+    void string_field(std::string_view name, std::string_view value) {
+        key(name);
+        string(value);
+    }
+    
+    void integer_field(std::string_view name, int64_t value) {
+        key(name);
+        integer(value);
+    }
+    
+    void bool_field(std::string_view name, bool value) {
+        key(name);
+        boolean(value);
+    }
+    
+    void raw_field(std::string_view name, std::string_view fragment) {
+        key(name);
+        raw(fragment);
+    }
+    
+    void json_text_field(std::string_view name, std::string_view fragment) {
+        key(name);
+        json_text(fragment);
+    }
+    
+    /**
+     * @brief Write a string-to-string map as an object
+     */
+    template <typename Map>
+    void string_map(const Map& map) {
+        begin_object();
+        for (const auto& [name, value] : map) {
+            string_field(name, value);
+        }
+        end_object();
+    }
+    
+    /**
+     * @brief Write a sequence of strings as an array
+     */
+    template <typename Sequence>
+    void string_array(const Sequence& values) {
+        begin_array();
+        for (const auto& value : values) {
+            string(value);
+        }
+        end_array();
+    }
+    
+    /**
+     * @brief Access the underlying output buffer
+     */
+    std::string& buffer() { return out_; }
+
+private:
+    void separate() {
+        if (need_comma_ && !cbor_) {
+            out_.push_back(',');
+        }
+    }
+    
+    /**
+     * @brief Start a string of known length; returns where its contents go
+     */
+    char* reserve_string(size_t length);
+    
+    /**
+     * @brief Append a CBOR head: major type and argument
+     */
+    void cbor_head(uint8_t major, uint64_t argument);
+    
+    /**
+     * @brief Append a CBOR text string, repairing ill-formed UTF-8
+     */
+    void cbor_text(std::string_view value);
+    
+    std::string& out_;
+    bool cbor_;
+    bool need_comma_ = false;
+};
+
+/**
+ * @brief Append the JSON-escaped form of a string (without quotes)
+ */
+void append_json_escaped(std::string& out, std::string_view value);
+
+} // namespace a2a
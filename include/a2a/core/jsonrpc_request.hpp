@@ -1,6 +1,8 @@
 #pragma once
 
+#include "json_writer.hpp"
 #include <string>
+#include <string_view>
 #include <optional>
 #include <memory>
 
@@ -15,11 +17,11 @@ public:
     
     JsonRpcRequest(const std::string& id, 
                    const std::string& method,
-                   const std::string& params_json = "{}")
+                   std::string params_json = "{}")
         : jsonrpc_("2.0")
         , id_(id)
         , method_(method)
-        , params_json_(params_json) {}
+        , params_json_(std::move(params_json)) {}
     
     // Getters
     const std::string& jsonrpc() const { return jsonrpc_; }
@@ -30,17 +32,24 @@ public:
     // Setters
     void set_id(const std::string& id) { id_ = id; }
     void set_method(const std::string& method) { method_ = method; }
-    void set_params_json(const std::string& params) { params_json_ = params; }
+    void set_params_json(std::string params) { params_json_ = std::move(params); }
     
     /**
      * @brief Serialize to JSON string
+     * params_json is spliced in verbatim, so it must already be valid JSON
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON string
+     * params are copied out as their original text, without re-serializing
      */
-    static JsonRpcRequest from_json(const std::string& json);
+    static JsonRpcRequest from_json(std::string_view json);
 
 private:
     std::string jsonrpc_ = "2.0";
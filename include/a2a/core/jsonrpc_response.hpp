@@ -1,7 +1,9 @@
 #pragma once
 
 #include "error_code.hpp"
+#include "json_writer.hpp"
 #include <string>
+#include <string_view>
 #include <optional>
 
 namespace a2a {
@@ -29,10 +31,10 @@ public:
     JsonRpcResponse() = default;
     
     // Success response
-    JsonRpcResponse(const std::string& id, const std::string& result_json)
+    JsonRpcResponse(const std::string& id, std::string result_json)
         : jsonrpc_("2.0")
         , id_(id)
-        , result_json_(result_json)
+        , result_json_(std::move(result_json))
         , error_() {}
     
     // Error response
@@ -53,13 +55,21 @@ public:
     
     /**
      * @brief Serialize to JSON string
+     * result_json is spliced in verbatim, so it must already be valid JSON
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON string
+     * The result is copied out as its original text; use JsonRpcResponseView
+     * to avoid even that copy.
      */
-    static JsonRpcResponse from_json(const std::string& json);
+    static JsonRpcResponse from_json(std::string_view json);
     
     /**
      * @brief Create error response
@@ -72,13 +82,57 @@ public:
      * @brief Create success response
      */
     static JsonRpcResponse create_success(const std::string& id, 
-                                         const std::string& result_json);
+                                         std::string result_json);
 
 private:
+    friend class JsonRpcResponseView;
+    
     std::string jsonrpc_ = "2.0";
     std::string id_;
     std::optional<std::string> result_json_;
     std::optional<JsonRpcError> error_;
 };
 
+/**
+ * @brief Non-owning view of a parsed JSON-RPC 2.0 Response
+ *
+ * result() is a span into the parsed buffer rather than a copy, so the
+ * buffer must outlive the view. Typical use is to parse the HTTP body and
+ * hand the span straight to a model's from_json(). The span is in the
+ * format the response was parsed from.
+ */
+class JsonRpcResponseView {
+public:
+    JsonRpcResponseView() = default;
+    
+    // Getters
+    const std::string& id() const { return id_; }
+    const std::optional<std::string_view>& result() const { return result_; }
+    const std::optional<JsonRpcError>& error() const { return error_; }
+    WireFormat format() const { return format_; }
+    
+    bool is_error() const { return error_.has_value(); }
+    bool is_success() const { return result_.has_value(); }
+    
+    /**
+     * @brief Parse a response without copying its result
+     * @throws A2AException with ErrorCode::ParseError on malformed input
+     */
+    static JsonRpcResponseView parse(std::string_view data,
+                                     WireFormat format = WireFormat::Json);
+    
+    /**
+     * @brief Materialize an owning JsonRpcResponse
+     *
+     * A CBOR result is converted to JSON text on the way.
+     */
+    JsonRpcResponse to_response() const;
+
+private:
+    std::string id_;
+    std::optional<std::string_view> result_;
+    std::optional<JsonRpcError> error_;
+    WireFormat format_ = WireFormat::Json;
+};
+
 } // namespace a2a
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <optional>
+#include <functional>
+
+namespace a2a {
+
+/**
+ * @brief One dispatched Server-Sent Event
+ *
+ * The views point into the parser's buffers and are only valid during the
+ * event callback.
+ */
+struct SseEvent {
+    /// Event type ("message" unless the frame set one)
+    std::string_view event;
+    
+    /// Data lines of the frame, joined with '\n'
+    std::string_view data;
+    
+    /// Last event id seen on the stream (persists across frames)
+    std::string_view id;
+};
+
+/**
+ * @brief Incremental text/event-stream parser
+ *
+ * Bytes are fed as they arrive, in chunks of any size; lines and frames
+ * may span chunk boundaries. Complete lines are parsed in place, and only
+ * a trailing partial line is copied, into a buffer reused for the life of
+ * the parser. Handles LF, CRLF and CR line endings, comments, multi-line
+ * data and the event, id and retry fields.
+ */
+class SseParser {
+public:
+    using EventCallback = std::function<void(const SseEvent&)>;
+    
+    explicit SseParser(EventCallback on_event)
+        : on_event_(std::move(on_event)) {}
+    
+    /**
+     * @brief Parse the next chunk of the stream
+     * Exceptions thrown by the callback propagate to the caller.
+     */
+    void feed(std::string_view chunk);
+    
+    /**
+     * @brief Forget any partial frame (the last event id and retry are kept)
+     */
+    void reset();
+    
+    const std::string& last_event_id() const { return last_event_id_; }
+    
+    /**
+     * @brief Reconnection delay last requested by the server, in milliseconds
+     */
+    const std::optional<long>& retry() const { return retry_; }
+
+private:
+    void process_line(std::string_view line);
+    void dispatch();
+    
+    EventCallback on_event_;
+    std::string line_;          // partial line carried over between chunks
+    std::string data_;
+    std::string event_;
+    std::string last_event_id_;
+    std::optional<long> retry_;
+    bool has_data_ = false;
+    bool pending_cr_ = false;   // previous chunk ended in '\r'
+    bool started_ = false;
+};
+
+} // namespace a2a
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace a2a {
+
+namespace detail {
+
+// 32-bit FNV-1a, perturbed by a seed
+constexpr uint32_t seeded_hash(std::string_view key, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Smallest power of two holding twice the keys, so a seed is found quickly
+constexpr size_t perfect_hash_table_size(size_t keys) {
+    size_t size = 1;
+    while (size < keys * 2) {
+        size <<= 1;
+    }
+    return size;
+}
+
+} // namespace detail
+
+/**
+ * @brief Fixed string-to-value map built at compile time
+ *
+ * The constructor searches for a hash seed under which every key lands in
+ * its own slot (a perfect hash), so find() costs one hash of the key and
+ * at most one string comparison, and never allocates. Intended for small
+ * fixed vocabularies such as method and enum names:
+ *
+ *     inline constexpr StaticStringMap<Color, 2> COLORS({{
+ *         {"red", Color::Red},
+ *         {"blue", Color::Blue},
+ *     }});
+ *
+ * Duplicate keys make the constant fail to compile.
+ */
+template <typename Value, size_t N>
+class StaticStringMap {
+public:
+    using Entry = std::pair<std::string_view, Value>;
+    
+    static_assert(N > 0 && N < 255, "StaticStringMap holds 1 to 254 keys");
+    
+    constexpr explicit StaticStringMap(const std::array<Entry, N>& entries)
+        : entries_(entries)
+        , slots_()
+        , seed_(0) {
+        // A throw during constant evaluation is a compile error
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = i + 1; j < N; ++j) {
+                if (entries_[i].first == entries_[j].first) {
+                    throw std::logic_error("StaticStringMap: duplicate key");
+                }
+            }
+        }
+        for (uint32_t seed = 0; seed < MAX_SEED; ++seed) {
+            if (try_seed(seed)) {
+                seed_ = seed;
+                return;
+            }
+        }
+        throw std::logic_error("StaticStringMap: no perfect hash found");
+    }
+    
+    /**
+     * @brief Look up a key
+     */
+    constexpr std::optional<Value> find(std::string_view key) const {
+        uint8_t slot = slots_[detail::seeded_hash(key, seed_) & (TABLE_SIZE - 1)];
+        if (slot != 0 && entries_[slot - 1].first == key) {
+            return entries_[slot - 1].second;
+        }
+        return std::nullopt;
+    }
+    
+    /**
+     * @brief Look up a key, returning @p fallback if it is absent
+     */
+    constexpr Value find_or(std::string_view key, Value fallback) const {
+        std::optional<Value> value = find(key);
+        return value ? *value : fallback;
+    }
+    
+    constexpr bool contains(std::string_view key) const {
+        return find(key).has_value();
+    }
+    
+    /**
+     * @brief Entries in the order given to the constructor
+     */
+    constexpr const std::array<Entry, N>& entries() const { return entries_; }
+    
+    static constexpr size_t size() { return N; }
+
+private:
+    static constexpr size_t TABLE_SIZE = detail::perfect_hash_table_size(N);
+    static constexpr uint32_t MAX_SEED = 4096;
+    
+    // Fill slots_ for a seed; false on a collision
+    constexpr bool try_seed(uint32_t seed) {
+        for (auto& slot : slots_) {
+            slot = 0;
+        }
+        for (size_t i = 0; i < N; ++i) {
+            uint8_t& slot = slots_[detail::seeded_hash(entries_[i].first, seed) & (TABLE_SIZE - 1)];
+            if (slot != 0) {
+                return false;
+            }
+            slot = static_cast<uint8_t>(i + 1);
+        }
+        return true;
+    }
+    
+    std::array<Entry, N> entries_;
+    std::array<uint8_t, TABLE_SIZE> slots_;  ///< Entry index + 1, or 0 if empty
+    uint32_t seed_;
+};
+
+} // namespace a2a
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "static_string_map.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <optional>
@@ -71,21 +73,45 @@ inline std::string to_string(TaskState state) {
     }
 }
 
-inline MessageRole message_role_from_string(const std::string& str) {
-    if (str == "user") return MessageRole::User;
-    if (str == "agent") return MessageRole::Agent;
-    if (str == "system") return MessageRole::System;
-    return MessageRole::User;
+namespace detail {
+
+inline constexpr StaticStringMap<MessageRole, 3> MESSAGE_ROLE_NAMES({{
+    {"user", MessageRole::User},
+    {"agent", MessageRole::Agent},
+    {"system", MessageRole::System},
+}});
+
+inline constexpr StaticStringMap<TaskState, 6> TASK_STATE_NAMES({{
+    {"submitted", TaskState::Submitted},
+    {"running", TaskState::Running},
+    {"completed", TaskState::Completed},
+    {"failed", TaskState::Failed},
+    {"canceled", TaskState::Canceled},
+    {"rejected", TaskState::Rejected},
+}});
+
+inline constexpr StaticStringMap<PartKind, 3> PART_KIND_NAMES({{
+    {"text", PartKind::Text},
+    {"file", PartKind::File},
+    {"data", PartKind::Data},
+}});
+
+} // namespace detail
+
+constexpr MessageRole message_role_from_string(std::string_view str) {
+    return detail::MESSAGE_ROLE_NAMES.find_or(str, MessageRole::User);
+}
+
+constexpr TaskState task_state_from_string(std::string_view str) {
+    return detail::TASK_STATE_NAMES.find_or(str, TaskState::Submitted);
 }
 
-inline TaskState task_state_from_string(const std::string& str) {
-    if (str == "submitted") return TaskState::Submitted;
-    if (str == "running") return TaskState::Running;
-    if (str == "completed") return TaskState::Completed;
-    if (str == "failed") return TaskState::Failed;
-    if (str == "canceled") return TaskState::Canceled;
-    if (str == "rejected") return TaskState::Rejected;
-    return TaskState::Submitted;
+/**
+ * @brief Part kind named by a "kind" member
+ * @return std::nullopt for kinds this SDK does not know
+ */
+constexpr std::optional<PartKind> part_kind_from_string(std::string_view str) {
+    return detail::PART_KIND_NAMES.find(str);
 }
 
 } // namespace a2a
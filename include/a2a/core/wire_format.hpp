@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace a2a {
+
+/**
+ * @brief Encoding of JSON-RPC messages on the wire
+ *
+ * CBOR (RFC 8949) carries the same data model as JSON in binary form:
+ * shorter length-prefixed strings, native integers and raw byte strings
+ * for file contents instead of base64. JsonWriter and JsonReader speak
+ * both, so every model's write_json()/read_json() handles either.
+ */
+enum class WireFormat {
+    Json,
+    Cbor
+};
+
+/**
+ * @brief Media type announcing a format in Content-Type
+ */
+constexpr std::string_view content_type(WireFormat format) {
+    return format == WireFormat::Cbor ? "application/cbor" : "application/json";
+}
+
+/**
+ * @brief Format named by a Content-Type header value
+ * @return WireFormat::Cbor for application/cbor (parameters ignored),
+ *         WireFormat::Json for anything else
+ */
+WireFormat wire_format_from_content_type(std::string_view content_type);
+
+/**
+ * @brief Re-encode one serialized value in another format
+ * @throws A2AException with ErrorCode::ParseError on malformed input
+ */
+std::string transcode(std::string_view value, WireFormat from, WireFormat to);
+
+} // namespace a2a
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "../core/types.hpp"
+#include "../core/json_writer.hpp"
+#include "../core/json_reader.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <optional>
@@ -17,7 +20,9 @@ struct AgentCapabilities {
     bool task_management = true;
     
     std::string to_json() const;
-    static AgentCapabilities from_json(const std::string& json);
+    void write_json(JsonWriter& writer) const;
+    static AgentCapabilities from_json(std::string_view json);
+    static AgentCapabilities read_json(JsonReader& reader);
 };
 
 /**
@@ -30,7 +35,9 @@ struct AgentSkill {
     std::vector<std::string> output_modes;
     
     std::string to_json() const;
-    static AgentSkill from_json(const std::string& json);
+    void write_json(JsonWriter& writer) const;
+    static AgentSkill from_json(std::string_view json);
+    static AgentSkill read_json(JsonReader& reader);
 };
 
 /**
@@ -42,7 +49,9 @@ struct AgentProvider {
     std::optional<std::string> url;
     
     std::string to_json() const;
-    static AgentProvider from_json(const std::string& json);
+    void write_json(JsonWriter& writer) const;
+    static AgentProvider from_json(std::string_view json);
+    static AgentProvider read_json(JsonReader& reader);
 };
 
 /**
@@ -96,10 +105,20 @@ public:
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON
      */
-    static AgentCard from_json(const std::string& json);
+    static AgentCard from_json(std::string_view json);
+    
+    /**
+     * @brief Read from the reader's next value
+     */
+    static AgentCard read_json(JsonReader& reader);
     
     /**
      * @brief Create a new AgentCard
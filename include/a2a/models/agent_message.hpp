@@ -1,51 +1,51 @@
 #pragma once
 
 #include "../core/types.hpp"
+#include "../core/id_generator.hpp"
 #include "message_part.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <optional>
-#include <ctime>
 
 namespace a2a {
 
 /**
  * @brief Agent Message - represents a message in the A2A protocol
+ *
+ * Parts are stored by value in one array, which may be allocated from a
+ * std::pmr::memory_resource, e.g. a per-request arena. Only that array
+ * comes from the resource: the parts' own strings (text, file data, data
+ * JSON) and the message's string fields always use the global heap. As
+ * with pmr containers, a copy uses the default resource (so it can safely
+ * outlive the arena) unless one is given, copy assignment keeps the
+ * target's resource, and a move keeps the source's.
  */
 class AgentMessage {
 public:
     AgentMessage() = default;
     
-    // Copy constructor
-    AgentMessage(const AgentMessage& other)
+    /**
+     * @brief Empty message whose parts array comes from resource
+     */
+    explicit AgentMessage(std::pmr::memory_resource* resource)
+        : parts_(resource ? resource : std::pmr::get_default_resource()) {}
+    
+    AgentMessage(const AgentMessage& other) = default;
+    
+    /**
+     * @brief Copy into a memory resource (nullptr = default resource)
+     */
+    AgentMessage(const AgentMessage& other, std::pmr::memory_resource* resource)
         : message_id_(other.message_id_)
         , context_id_(other.context_id_)
         , task_id_(other.task_id_)
         , role_(other.role_)
-    {
-        // Deep copy parts
-        for (const auto& part : other.parts_) {
-            parts_.push_back(part->clone());
-        }
-    }
+        , parts_(other.parts_, resource ? resource : std::pmr::get_default_resource()) {}
     
-    // Copy assignment
-    AgentMessage& operator=(const AgentMessage& other) {
-        if (this != &other) {
-            message_id_ = other.message_id_;
-            context_id_ = other.context_id_;
-            task_id_ = other.task_id_;
-            role_ = other.role_;
-            
-            // Deep copy parts
-            parts_.clear();
-            for (const auto& part : other.parts_) {
-                parts_.push_back(part->clone());
-            }
-        }
-        return *this;
-    }
+    AgentMessage& operator=(const AgentMessage& other) = default;
     
     // Move constructor and assignment (default)
     AgentMessage(AgentMessage&&) = default;
@@ -56,7 +56,13 @@ public:
     const std::optional<std::string>& context_id() const { return context_id_; }
     const std::optional<std::string>& task_id() const { return task_id_; }
     MessageRole role() const { return role_; }
-    const std::vector<std::unique_ptr<Part>>& parts() const { return parts_; }
+    const std::pmr::vector<MessagePart>& parts() const { return parts_; }
+    
+    /**
+     * @brief Resource the parts array is allocated from (the parts' strings
+     * are not)
+     */
+    std::pmr::memory_resource* resource() const { return parts_.get_allocator().resource(); }
     
     // Setters
     void set_message_id(const std::string& id) { message_id_ = id; }
@@ -67,40 +73,57 @@ public:
     /**
      * @brief Add a text part to the message
      */
-    void add_text_part(const std::string& text) {
-        parts_.push_back(std::make_unique<TextPart>(text));
+    void add_text_part(std::string text) {
+        parts_.emplace_back(TextPart(std::move(text)));
     }
     
     /**
      * @brief Add a file part to the message
      */
-    void add_file_part(const std::string& filename, 
-                      const std::string& mime_type,
-                      const std::vector<uint8_t>& data) {
-        parts_.push_back(std::make_unique<FilePart>(filename, mime_type, data));
+    void add_file_part(std::string filename,
+                      std::string mime_type,
+                      std::vector<uint8_t> data) {
+        parts_.emplace_back(FilePart(std::move(filename), std::move(mime_type), std::move(data)));
     }
     
     /**
      * @brief Add a data part to the message
      */
-    void add_data_part(const std::string& data_json) {
-        parts_.push_back(std::make_unique<DataPart>(data_json));
+    void add_data_part(std::string data_json) {
+        parts_.emplace_back(DataPart(std::move(data_json)));
     }
     
     /**
-     * @brief Add a part (takes ownership)
+     * @brief Add a part
      */
-    void add_part(std::unique_ptr<Part> part) {
+    void add_part(MessagePart part) {
         parts_.push_back(std::move(part));
     }
     
+    /**
+     * @brief Add a heap-allocated part (its contents are moved into the message)
+     */
+    void add_part(std::unique_ptr<Part> part) {
+        switch (part->kind()) {
+            case PartKind::Text:
+                parts_.emplace_back(std::move(static_cast<TextPart&>(*part)));
+                break;
+            case PartKind::File:
+                parts_.emplace_back(std::move(static_cast<FilePart&>(*part)));
+                break;
+            case PartKind::Data:
+                parts_.emplace_back(std::move(static_cast<DataPart&>(*part)));
+                break;
+        }
+    }
+    
     /**
      * @brief Get the first text part content (convenience method)
      */
     std::string get_text() const {
         for (const auto& part : parts_) {
-            if (part->kind() == PartKind::Text) {
-                return static_cast<const TextPart*>(part.get())->text();
+            if (const auto* text = part.get_if<TextPart>()) {
+                return text->text();
             }
         }
         return "";
@@ -111,17 +134,30 @@ public:
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON
+     * @param resource Memory resource for the parts array (nullptr = default)
+     */
+    static AgentMessage from_json(std::string_view json,
+                                  std::pmr::memory_resource* resource = nullptr);
+    
+    /**
+     * @brief Read from the reader's next value
      */
-    static AgentMessage from_json(const std::string& json);
+    static AgentMessage read_json(JsonReader& reader,
+                                  std::pmr::memory_resource* resource = nullptr);
     
     /**
      * @brief Create a new AgentMessage with default values
      */
     static AgentMessage create() {
         AgentMessage msg;
-        msg.message_id_ = "msg-" + std::to_string(std::time(nullptr));
+        msg.message_id_ = generate_id();
         return msg;
     }
     
@@ -148,8 +184,8 @@ public:
         return *this;
     }
     
-    AgentMessage& with_text(const std::string& text) {
-        add_text_part(text);
+    AgentMessage& with_text(std::string text) {
+        add_text_part(std::move(text));
         return *this;
     }
 
@@ -158,7 +194,7 @@ private:
     std::optional<std::string> context_id_;
     std::optional<std::string> task_id_;
     MessageRole role_ = MessageRole::User;
-    std::vector<std::unique_ptr<Part>> parts_;
+    std::pmr::vector<MessagePart> parts_;
 };
 
 } // namespace a2a
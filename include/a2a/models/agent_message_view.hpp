@@ -0,0 +1,96 @@
+#pragma once
+
+#include "agent_message.hpp"
+#include "../core/wire_format.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace a2a {
+
+/**
+ * @brief Lazily decoded view of a serialized Message
+ *
+ * Parsing indexes the message in a single pass: the ids and role are
+ * decoded, but each part is only located (its kind, its source text and,
+ * for text parts, the text literal). Part contents such as file data are
+ * decoded only when part() or to_message() asks for them, so a handler
+ * that routes on get_text() or task_id() never pays for large parts.
+ *
+ * The view points into the parsed buffer, which must outlive it.
+ */
+class AgentMessageView {
+public:
+    AgentMessageView() = default;
+    
+    // Getters
+    const std::string& message_id() const { return message_id_; }
+    const std::optional<std::string>& context_id() const { return context_id_; }
+    const std::optional<std::string>& task_id() const { return task_id_; }
+    MessageRole role() const { return role_; }
+    
+    /**
+     * @brief Source text of the whole message, e.g. to forward it as is
+     */
+    std::string_view raw() const { return raw_; }
+    
+    /**
+     * @brief Encoding of raw() and of each part's source
+     */
+    WireFormat format() const { return format_; }
+    
+    size_t part_count() const { return parts_.size(); }
+    PartKind part_kind(size_t index) const { return parts_.at(index).kind; }
+    
+    /**
+     * @brief Source text of one part
+     */
+    std::string_view raw_part(size_t index) const { return parts_.at(index).raw; }
+    
+    /**
+     * @brief Decode one part
+     */
+    MessagePart part(size_t index) const;
+    
+    /**
+     * @brief Decode the first text part's content (other parts stay encoded)
+     */
+    std::string get_text() const;
+    
+    /**
+     * @brief Decode the whole message
+     * @param resource Memory resource for the parts array (nullptr = default)
+     */
+    AgentMessage to_message(std::pmr::memory_resource* resource = nullptr) const;
+    
+    /**
+     * @brief Index a message
+     * @throws A2AException with ErrorCode::ParseError on malformed input
+     */
+    static AgentMessageView parse(std::string_view data, WireFormat format = WireFormat::Json);
+    
+    /**
+     * @brief Index the reader's next value (a view into the reader's input)
+     */
+    static AgentMessageView read_json(JsonReader& reader);
+
+private:
+    struct PartIndex {
+        PartKind kind;
+        std::string_view raw;
+        std::string_view text;  ///< Encoded "text" member of a text part
+    };
+    
+    std::string message_id_;
+    std::optional<std::string> context_id_;
+    std::optional<std::string> task_id_;
+    MessageRole role_ = MessageRole::User;
+    std::string_view raw_;
+    WireFormat format_ = WireFormat::Json;
+    std::vector<PartIndex> parts_;
+};
+
+} // namespace a2a
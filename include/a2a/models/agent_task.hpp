@@ -3,7 +3,9 @@
 #include "task_status.hpp"
 #include "artifact.hpp"
 #include "agent_message.hpp"
+#include "message_history.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <memory>
@@ -27,7 +29,7 @@ public:
     const std::string& context_id() const { return context_id_; }
     const AgentTaskStatus& status() const { return status_; }
     const std::vector<Artifact>& artifacts() const { return artifacts_; }
-    const std::vector<AgentMessage>& history() const { return history_; }
+    const MessageHistory& history() const { return history_; }
     const std::map<std::string, std::string>& metadata() const { return metadata_; }
     
     // Setters
@@ -50,6 +52,36 @@ public:
         history_.push_back(message);
     }
     
+    /**
+     * @brief Add a message to the history, moving its parts if they use
+     * the default memory resource
+     */
+    void add_history_message(AgentMessage&& message) {
+        history_.push_back(std::move(message));
+    }
+    
+    /**
+     * @brief Add a message shared with other holders, without copying it
+     * Its parts must use the default memory resource.
+     */
+    void add_history_message(std::shared_ptr<const AgentMessage> message) {
+        history_.push_back(std::move(message));
+    }
+    
+    /**
+     * @brief Drop the oldest history messages, keeping at most @p max
+     */
+    void trim_history(size_t max) {
+        history_.trim(max);
+    }
+    
+    /**
+     * @brief Limit the history, now and as messages are added (0 = unbounded)
+     */
+    void set_history_capacity(size_t capacity) {
+        history_.set_capacity(capacity);
+    }
+    
     /**
      * @brief Add metadata
      */
@@ -69,10 +101,24 @@ public:
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON
+     * @param resource Scratch memory for parsing history messages (nullptr =
+     *        default); the task keeps copies in the default resource
+     */
+    static AgentTask from_json(std::string_view json,
+                               std::pmr::memory_resource* resource = nullptr);
+    
+    /**
+     * @brief Read from the reader's next value
      */
-    static AgentTask from_json(const std::string& json);
+    static AgentTask read_json(JsonReader& reader,
+                               std::pmr::memory_resource* resource = nullptr);
     
     /**
      * @brief Create a new AgentTask
@@ -114,7 +160,7 @@ private:
     std::string context_id_;
     AgentTaskStatus status_;
     std::vector<Artifact> artifacts_;
-    std::vector<AgentMessage> history_;
+    MessageHistory history_;
     std::map<std::string, std::string> metadata_;
 };
 
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "../core/json_writer.hpp"
+#include "../core/json_reader.hpp"
 #include <string>
+#include <string_view>
 #include <optional>
 #include <map>
 
@@ -41,10 +44,20 @@ public:
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON
      */
-    static Artifact from_json(const std::string& json);
+    static Artifact from_json(std::string_view json);
+    
+    /**
+     * @brief Read from the reader's next value
+     */
+    static Artifact read_json(JsonReader& reader);
     
     /**
      * @brief Create a new Artifact
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "agent_message.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace a2a {
+
+/**
+ * @brief Message history of a task: a ring buffer of shared messages
+ *
+ * Messages are immutable once added and held by shared pointer, so
+ * copying a history (and the task holding it) copies pointers rather than
+ * message contents, and tail() and range() return the stored messages
+ * themselves in O(count). Each message is numbered on arrival, from 0 for
+ * the first; a message keeps its sequence number when older ones are
+ * dropped. With a capacity, adding to a full history drops the oldest
+ * message in O(1).
+ */
+class MessageHistory {
+public:
+    using MessagePtr = std::shared_ptr<const AgentMessage>;
+    
+    /**
+     * @brief Random-access iterator over the messages, oldest first
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = AgentMessage;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const AgentMessage*;
+        using reference = const AgentMessage&;
+        
+        const_iterator() = default;
+        
+        reference operator*() const { return (*history_)[index_]; }
+        pointer operator->() const { return &(*history_)[index_]; }
+        reference operator[](difference_type n) const { return (*history_)[index_ + n]; }
+        
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator it = *this; ++index_; return it; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator it = *this; --index_; return it; }
+        const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(history_, index_ + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(history_, index_ - n); }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+        
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+        bool operator<(const const_iterator& other) const { return index_ < other.index_; }
+    
+    private:
+        friend class MessageHistory;
+        
+        const_iterator(const MessageHistory* history, size_t index)
+            : history_(history)
+            , index_(index) {}
+        
+        const MessageHistory* history_ = nullptr;
+        size_t index_ = 0;
+    };
+    
+    /**
+     * @param capacity Most messages kept, oldest dropped first (0 = unbounded)
+     */
+    explicit MessageHistory(size_t capacity = 0)
+        : capacity_(capacity) {}
+    
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    
+    /**
+     * @brief Most messages kept (0 = unbounded)
+     */
+    size_t capacity() const { return capacity_; }
+    
+    /**
+     * @brief Change the capacity, dropping the oldest messages beyond it
+     */
+    void set_capacity(size_t capacity);
+    
+    /**
+     * @brief Sequence number of the oldest message kept
+     */
+    uint64_t first_sequence() const { return next_sequence_ - size_; }
+    
+    /**
+     * @brief Sequence number the next message will get
+     */
+    uint64_t next_sequence() const { return next_sequence_; }
+    
+    /**
+     * @brief Add a message, dropping the oldest if the history is full
+     *
+     * The history can outlive any arena, so a message whose parts come from
+     * another memory resource is copied into the default one. A shared
+     * message is stored as is and must already use the default resource.
+     * @return The message's sequence number
+     */
+    uint64_t push_back(MessagePtr message);
+    uint64_t push_back(AgentMessage message) {
+        if (message.resource() != std::pmr::get_default_resource()) {
+            return push_back(std::make_shared<const AgentMessage>(message, nullptr));
+        }
+        return push_back(std::make_shared<const AgentMessage>(std::move(message)));
+    }
+    
+    /**
+     * @brief Message by position, 0 being the oldest kept
+     */
+    const AgentMessage& operator[](size_t index) const { return *slot(index); }
+    const MessagePtr& ptr(size_t index) const { return slot(index); }
+    
+    const AgentMessage& front() const { return *slot(0); }
+    const AgentMessage& back() const { return *slot(size_ - 1); }
+    
+    /**
+     * @brief The newest messages, oldest first
+     * @param count Number of messages (0 = all)
+     */
+    std::vector<MessagePtr> tail(size_t count) const;
+    
+    /**
+     * @brief Messages by sequence number, oldest first
+     *
+     * Starts at @p from_sequence, or at the oldest message kept if that one
+     * was already dropped.
+     * @param count Maximum number of messages (0 = up to the newest)
+     */
+    std::vector<MessagePtr> range(uint64_t from_sequence, size_t count = 0) const;
+    
+    /**
+     * @brief Drop the oldest messages, keeping at most @p max
+     */
+    void trim(size_t max);
+    
+    /**
+     * @brief Drop every message; numbering continues where it was
+     */
+    void clear();
+    
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+
+private:
+    const MessagePtr& slot(size_t index) const { return ring_[(head_ + index) % ring_.size()]; }
+    
+    // Move the messages into a buffer of @p slots, oldest first
+    void reallocate(size_t slots);
+    
+    std::vector<MessagePtr> ring_;
+    size_t head_ = 0;  ///< Slot of the oldest message
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+    uint64_t next_sequence_ = 0;
+};
+
+} // namespace a2a
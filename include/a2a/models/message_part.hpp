@@ -1,42 +1,96 @@
 #pragma once
 
 #include "../core/types.hpp"
+#include "../core/json_writer.hpp"
+#include "../core/json_reader.hpp"
 #include <string>
+#include <string_view>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <variant>
 #include <vector>
 
 namespace a2a {
 
 /**
  * @brief Base class for message parts (polymorphic)
+ *
+ * Messages store parts by value (see MessagePart); the base class remains
+ * for code that handles parts through pointers. Heap parts may be
+ * allocated from a std::pmr::memory_resource (see make()); each part
+ * remembers its resource, so the usual unique_ptr<Part> frees it
+ * correctly. Only the part object itself comes from the resource; its
+ * strings use the global heap. A part must be destroyed before its
+ * resource is released.
  */
 class Part {
 public:
     virtual ~Part() = default;
     
     virtual PartKind kind() const = 0;
-    virtual std::string to_json() const = 0;
-    virtual std::unique_ptr<Part> clone() const = 0;
     
-    static std::unique_ptr<Part> from_json(const std::string& json);
+    /**
+     * @brief Copy into a memory resource (nullptr = default resource)
+     */
+    virtual std::unique_ptr<Part> clone(std::pmr::memory_resource* resource) const = 0;
+    
+    std::unique_ptr<Part> clone() const { return clone(nullptr); }
+    
+    /**
+     * @brief Construct a part in a memory resource (nullptr = default resource)
+     */
+    template <typename T, typename... Args>
+    static std::unique_ptr<T> make(std::pmr::memory_resource* resource, Args&&... args) {
+        return std::unique_ptr<T>(new (resource) T(std::forward<Args>(args)...));
+    }
+    
+    // Allocation goes through the part's memory resource
+    static void* operator new(std::size_t size);
+    static void* operator new(std::size_t size, std::pmr::memory_resource* resource);
+    static void operator delete(void* ptr) noexcept;
+    static void operator delete(void* ptr, std::pmr::memory_resource* resource) noexcept;
+    
+    /**
+     * @brief Append this part to a JSON writer
+     */
+    virtual void write_json(JsonWriter& writer) const = 0;
+    
+    /**
+     * @brief Serialize to JSON
+     */
+    std::string to_json() const;
+    
+    /**
+     * @brief Read a part from the reader's next value
+     * @param resource Memory resource for the part (nullptr = default)
+     * @return nullptr if the kind is missing or unknown
+     */
+    static std::unique_ptr<Part> read_json(JsonReader& reader,
+                                           std::pmr::memory_resource* resource = nullptr);
+    
+    static std::unique_ptr<Part> from_json(std::string_view json,
+                                           std::pmr::memory_resource* resource = nullptr);
 };
 
 /**
  * @brief Text message part
  */
-class TextPart : public Part {
+class TextPart final : public Part {
 public:
     TextPart() = default;
-    explicit TextPart(const std::string& text) : text_(text) {}
+    explicit TextPart(std::string text) : text_(std::move(text)) {}
     
     PartKind kind() const override { return PartKind::Text; }
     
     const std::string& text() const { return text_; }
     void set_text(const std::string& text) { text_ = text; }
     
-    std::string to_json() const override;
-    std::unique_ptr<Part> clone() const override {
-        return std::make_unique<TextPart>(text_);
+    void write_json(JsonWriter& writer) const override;
+    
+    using Part::clone;
+    std::unique_ptr<Part> clone(std::pmr::memory_resource* resource) const override {
+        return make<TextPart>(resource, text_);
     }
 
 private:
@@ -46,14 +100,13 @@ private:
 /**
  * @brief File message part
  */
-class FilePart : public Part {
+class FilePart final : public Part {
 public:
     FilePart() = default;
-    FilePart(const std::string& filename, const std::string& mime_type, 
-             const std::vector<uint8_t>& data)
-        : filename_(filename)
-        , mime_type_(mime_type)
-        , data_(data) {}
+    FilePart(std::string filename, std::string mime_type, std::vector<uint8_t> data)
+        : filename_(std::move(filename))
+        , mime_type_(std::move(mime_type))
+        , data_(std::move(data)) {}
     
     PartKind kind() const override { return PartKind::File; }
     
@@ -65,9 +118,11 @@ public:
     void set_mime_type(const std::string& type) { mime_type_ = type; }
     void set_data(const std::vector<uint8_t>& data) { data_ = data; }
     
-    std::string to_json() const override;
-    std::unique_ptr<Part> clone() const override {
-        return std::make_unique<FilePart>(filename_, mime_type_, data_);
+    void write_json(JsonWriter& writer) const override;
+    
+    using Part::clone;
+    std::unique_ptr<Part> clone(std::pmr::memory_resource* resource) const override {
+        return make<FilePart>(resource, filename_, mime_type_, data_);
     }
 
 private:
@@ -79,23 +134,98 @@ private:
 /**
  * @brief Data message part (structured data)
  */
-class DataPart : public Part {
+class DataPart final : public Part {
 public:
     DataPart() = default;
-    explicit DataPart(const std::string& data_json) : data_json_(data_json) {}
+    explicit DataPart(std::string data_json) : data_json_(std::move(data_json)) {}
     
     PartKind kind() const override { return PartKind::Data; }
     
     const std::string& data_json() const { return data_json_; }
     void set_data_json(const std::string& json) { data_json_ = json; }
     
-    std::string to_json() const override;
-    std::unique_ptr<Part> clone() const override {
-        return std::make_unique<DataPart>(data_json_);
+    void write_json(JsonWriter& writer) const override;
+    
+    using Part::clone;
+    std::unique_ptr<Part> clone(std::pmr::memory_resource* resource) const override {
+        return make<DataPart>(resource, data_json_);
     }
 
 private:
     std::string data_json_;
 };
 
+/**
+ * @brief One part of a message, stored by value
+ *
+ * Holds a TextPart, FilePart or DataPart inline, so a message's parts sit
+ * in one contiguous array with no per-part allocation. Inspect it with
+ * get_if<T>() or visit(); get() and -> give the Part* interface of the
+ * former std::unique_ptr<Part> elements.
+ */
+class MessagePart {
+public:
+    using Value = std::variant<TextPart, FilePart, DataPart>;
+    
+    MessagePart(TextPart part) : value_(std::move(part)) {}
+    MessagePart(FilePart part) : value_(std::move(part)) {}
+    MessagePart(DataPart part) : value_(std::move(part)) {}
+    
+    PartKind kind() const {
+        // Alternatives are in PartKind order
+        return static_cast<PartKind>(value_.index());
+    }
+    
+    const Value& value() const { return value_; }
+    Value& value() { return value_; }
+    
+    /**
+     * @brief The part as T, or nullptr if it holds another kind
+     */
+    template <typename T>
+    const T* get_if() const { return std::get_if<T>(&value_); }
+    
+    template <typename T>
+    T* get_if() { return std::get_if<T>(&value_); }
+    
+    /**
+     * @brief Call visitor with the concrete part
+     */
+    template <typename Visitor>
+    decltype(auto) visit(Visitor&& visitor) const {
+        return std::visit(std::forward<Visitor>(visitor), value_);
+    }
+    
+    template <typename Visitor>
+    decltype(auto) visit(Visitor&& visitor) {
+        return std::visit(std::forward<Visitor>(visitor), value_);
+    }
+    
+    /**
+     * @brief Append this part to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const {
+        visit([&writer](const auto& part) { part.write_json(writer); });
+    }
+    
+    /**
+     * @brief Read a part from the reader's next value
+     * @return nullopt if the kind is missing or unknown
+     */
+    static std::optional<MessagePart> read_json(JsonReader& reader);
+    
+    // Compatibility with std::unique_ptr<Part> (non-const like unique_ptr::get())
+    Part* get() const {
+        return std::visit([](const auto& part) {
+            return const_cast<Part*>(static_cast<const Part*>(&part));
+        }, value_);
+    }
+    Part* operator->() const { return get(); }
+    Part& operator*() const { return *get(); }
+    explicit operator bool() const { return true; }
+
+private:
+    Value value_;
+};
+
 } // namespace a2a
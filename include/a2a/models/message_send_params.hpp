@@ -1,7 +1,9 @@
 #pragma once
 
 #include "agent_message.hpp"
+#include "agent_message_view.hpp"
 #include <optional>
+#include <string_view>
 
 namespace a2a {
 
@@ -15,6 +17,9 @@ public:
     explicit MessageSendParams(const AgentMessage& message)
         : message_(message) {}
     
+    explicit MessageSendParams(AgentMessage&& message)
+        : message_(std::move(message)) {}
+    
     // Getters
     const AgentMessage& message() const { return message_; }
     const std::optional<int>& history_length() const { return history_length_; }
@@ -32,10 +37,23 @@ public:
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON
+     * @param resource Memory resource for the message parts (nullptr = default)
+     */
+    static MessageSendParams from_json(std::string_view json,
+                                       std::pmr::memory_resource* resource = nullptr);
+    
+    /**
+     * @brief Read from the reader's next value
      */
-    static MessageSendParams from_json(const std::string& json);
+    static MessageSendParams read_json(JsonReader& reader,
+                                       std::pmr::memory_resource* resource = nullptr);
     
     /**
      * @brief Create a new MessageSendParams
@@ -74,6 +92,40 @@ private:
     std::optional<std::string> task_id_;
 };
 
+/**
+ * @brief MessageSendParams whose message is an AgentMessageView
+ *
+ * Points into the parsed buffer, which must outlive it.
+ */
+class MessageSendParamsView {
+public:
+    MessageSendParamsView() = default;
+    
+    // Getters
+    const AgentMessageView& message() const { return message_; }
+    const std::optional<int>& history_length() const { return history_length_; }
+    const std::optional<std::string>& context_id() const { return context_id_; }
+    const std::optional<std::string>& task_id() const { return task_id_; }
+    
+    /**
+     * @brief Decode into MessageSendParams
+     * @param resource Memory resource for the message parts (nullptr = default)
+     */
+    MessageSendParams to_params(std::pmr::memory_resource* resource = nullptr) const;
+    
+    /**
+     * @brief Index params without decoding the message parts
+     * @throws A2AException with ErrorCode::ParseError on malformed input
+     */
+    static MessageSendParamsView parse(std::string_view data, WireFormat format = WireFormat::Json);
+
+private:
+    AgentMessageView message_;
+    std::optional<int> history_length_;
+    std::optional<std::string> context_id_;
+    std::optional<std::string> task_id_;
+};
+
 /**
  * @brief Parameters for querying a task
  */
@@ -83,7 +135,9 @@ struct TaskQueryParams {
     std::map<std::string, std::string> metadata;
     
     std::string to_json() const;
-    static TaskQueryParams from_json(const std::string& json);
+    void write_json(JsonWriter& writer) const;
+    static TaskQueryParams from_json(std::string_view json);
+    static TaskQueryParams read_json(JsonReader& reader);
 };
 
 /**
@@ -93,7 +147,9 @@ struct TaskIdParams {
     std::string id;
     
     std::string to_json() const;
-    static TaskIdParams from_json(const std::string& json);
+    void write_json(JsonWriter& writer) const;
+    static TaskIdParams from_json(std::string_view json);
+    static TaskIdParams read_json(JsonReader& reader);
 };
 
 } // namespace a2a
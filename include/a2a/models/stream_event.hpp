@@ -0,0 +1,63 @@
+#pragma once
+
+#include "agent_task.hpp"
+#include "agent_message.hpp"
+#include "task_events.hpp"
+#include <string_view>
+#include <variant>
+
+namespace a2a {
+
+/**
+ * @brief One result of a streaming request (message/stream, tasks/resubscribe)
+ */
+class StreamEvent {
+public:
+    enum class Type {
+        Task,
+        Message,
+        StatusUpdate,
+        ArtifactUpdate
+    };
+    
+    StreamEvent(const AgentTask& task) : value_(task) {}
+    StreamEvent(const AgentMessage& message) : value_(message) {}
+    StreamEvent(const TaskStatusUpdateEvent& event) : value_(event) {}
+    StreamEvent(const TaskArtifactUpdateEvent& event) : value_(event) {}
+    
+    Type type() const { return static_cast<Type>(value_.index()); }
+    
+    bool is_task() const { return type() == Type::Task; }
+    bool is_message() const { return type() == Type::Message; }
+    bool is_status_update() const { return type() == Type::StatusUpdate; }
+    bool is_artifact_update() const { return type() == Type::ArtifactUpdate; }
+    
+    const AgentTask& as_task() const { return std::get<AgentTask>(value_); }
+    const AgentMessage& as_message() const { return std::get<AgentMessage>(value_); }
+    const TaskStatusUpdateEvent& as_status_update() const {
+        return std::get<TaskStatusUpdateEvent>(value_);
+    }
+    const TaskArtifactUpdateEvent& as_artifact_update() const {
+        return std::get<TaskArtifactUpdateEvent>(value_);
+    }
+    
+    /**
+     * @brief Whether the stream ends with this event
+     * True for a Message and for a final status update.
+     */
+    bool is_final() const {
+        return is_message() || (is_status_update() && as_status_update().is_final());
+    }
+    
+    /**
+     * @brief Parse a JSON-RPC result, telling the kinds apart by "kind"
+     * (or, for peers that omit it, by the members present)
+     */
+    static StreamEvent from_json(std::string_view json);
+
+private:
+    // Alternatives are in Type order
+    std::variant<AgentTask, AgentMessage, TaskStatusUpdateEvent, TaskArtifactUpdateEvent> value_;
+};
+
+} // namespace a2a
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "task_status.hpp"
+#include "artifact.hpp"
+#include "../core/json_writer.hpp"
+#include "../core/json_reader.hpp"
+#include <string>
+#include <string_view>
+
+namespace a2a {
+
+/**
+ * @brief Streaming event sent when a task's status changes
+ */
+class TaskStatusUpdateEvent {
+public:
+    TaskStatusUpdateEvent() = default;
+    
+    TaskStatusUpdateEvent(const std::string& task_id,
+                          const std::string& context_id,
+                          const AgentTaskStatus& status,
+                          bool final)
+        : task_id_(task_id)
+        , context_id_(context_id)
+        , status_(status)
+        , final_(final) {}
+    
+    // Getters
+    const std::string& task_id() const { return task_id_; }
+    const std::string& context_id() const { return context_id_; }
+    const AgentTaskStatus& status() const { return status_; }
+    
+    /**
+     * @brief Whether this is the last event of the stream
+     */
+    bool is_final() const { return final_; }
+    
+    /**
+     * @brief Serialize to JSON
+     */
+    std::string to_json() const;
+    
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
+    /**
+     * @brief Deserialize from JSON
+     */
+    static TaskStatusUpdateEvent from_json(std::string_view json);
+    
+    /**
+     * @brief Read from the reader's next value
+     */
+    static TaskStatusUpdateEvent read_json(JsonReader& reader);
+
+private:
+    std::string task_id_;
+    std::string context_id_;
+    AgentTaskStatus status_;
+    bool final_ = false;
+};
+
+/**
+ * @brief Streaming event sent when a task produces an artifact
+ */
+class TaskArtifactUpdateEvent {
+public:
+    TaskArtifactUpdateEvent() = default;
+    
+    TaskArtifactUpdateEvent(const std::string& task_id,
+                            const std::string& context_id,
+                            const Artifact& artifact)
+        : task_id_(task_id)
+        , context_id_(context_id)
+        , artifact_(artifact) {}
+    
+    // Getters
+    const std::string& task_id() const { return task_id_; }
+    const std::string& context_id() const { return context_id_; }
+    const Artifact& artifact() const { return artifact_; }
+    
+    /**
+     * @brief Whether the artifact extends one sent earlier
+     */
+    bool append() const { return append_; }
+    
+    /**
+     * @brief Whether this is the last chunk of the artifact
+     */
+    bool last_chunk() const { return last_chunk_; }
+    
+    // Setters
+    void set_append(bool append) { append_ = append; }
+    void set_last_chunk(bool last_chunk) { last_chunk_ = last_chunk; }
+    
+    /**
+     * @brief Serialize to JSON
+     */
+    std::string to_json() const;
+    
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
+    /**
+     * @brief Deserialize from JSON
+     */
+    static TaskArtifactUpdateEvent from_json(std::string_view json);
+    
+    /**
+     * @brief Read from the reader's next value
+     */
+    static TaskArtifactUpdateEvent read_json(JsonReader& reader);
+
+private:
+    std::string task_id_;
+    std::string context_id_;
+    Artifact artifact_;
+    bool append_ = false;
+    bool last_chunk_ = true;
+};
+
+} // namespace a2a
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "../core/types.hpp"
+#include "../core/json_writer.hpp"
+#include "../core/json_reader.hpp"
 #include <string>
+#include <string_view>
 #include <chrono>
 
 namespace a2a {
@@ -48,10 +51,20 @@ public:
      */
     std::string to_json() const;
     
+    /**
+     * @brief Append to a JSON writer
+     */
+    void write_json(JsonWriter& writer) const;
+    
     /**
      * @brief Deserialize from JSON
      */
-    static AgentTaskStatus from_json(const std::string& json);
+    static AgentTaskStatus from_json(std::string_view json);
+    
+    /**
+     * @brief Read from the reader's next value
+     */
+    static AgentTaskStatus read_json(JsonReader& reader);
 
 private:
     TaskState state_;
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "task_store.hpp"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace a2a {
+
+/**
+ * @brief Limits for CachingTaskStore
+ */
+struct CachingTaskStoreOptions {
+    /// Approximate memory the cached tasks may use; least recently used go first
+    size_t max_bytes = 64 * 1024 * 1024;
+    
+    /// Longest a task is served from memory before being read again
+    /// (0 = until evicted or invalidated)
+    std::chrono::milliseconds ttl{0};
+    
+    /// History messages kept per cached task; set it to the backing store's
+    /// own limit (e.g. RedisTaskStoreOptions::max_history) (0 = unbounded)
+    size_t max_history = 0;
+};
+
+/**
+ * @brief In-process cache in front of another (typically remote) ITaskStore
+ *
+ * Reads are served from a least-recently-used cache of task snapshots,
+ * loading a task from the backing store on a miss. Writes go to the
+ * backing store first and are then applied to the cached copy
+ * (write-through), so this process always reads its own writes; writes
+ * to one task are applied in the same order on both.
+ *
+ * Writes made by other processes reach the cache only through
+ * invalidate(), or when the ttl expires. With RedisTaskStore, enable
+ * RedisTaskStoreOptions::publish_changes and forward its notifications:
+ *
+ *     auto redis = std::make_shared<RedisTaskStore>(options);
+ *     auto cache = std::make_shared<CachingTaskStore>(redis);
+ *     redis->subscribe_changes([weak = std::weak_ptr<CachingTaskStore>(cache)](const std::string& id) {
+ *         if (auto cache = weak.lock()) {
+ *             id.empty() ? cache->clear() : cache->invalidate(id);
+ *         }
+ *     });
+ *
+ * Misses are not cached: task_exists() on an unknown id always asks the
+ * backing store. Thread-safe if the backing store is.
+ */
+class CachingTaskStore : public ITaskStore {
+public:
+    explicit CachingTaskStore(std::shared_ptr<ITaskStore> store,
+                              const CachingTaskStoreOptions& options = CachingTaskStoreOptions());
+    
+    ~CachingTaskStore() override;
+    
+    // Disable copy and move
+    CachingTaskStore(const CachingTaskStore&) = delete;
+    CachingTaskStore& operator=(const CachingTaskStore&) = delete;
+    
+    // ITaskStore interface implementation
+    std::optional<AgentTask> get_task(const std::string& task_id) override;
+    std::shared_ptr<const AgentTask> get_task_snapshot(const std::string& task_id) override;
+    void set_task(const AgentTask& task) override;
+    void update_status(const std::string& task_id,
+                      TaskState status,
+                      const std::string& message = "") override;
+    void add_artifact(const std::string& task_id,
+                     const Artifact& artifact) override;
+    void add_history_message(const std::string& task_id,
+                            const AgentMessage& message) override;
+    std::vector<AgentMessage> get_history(const std::string& context_id,
+                                          int max_length = 0) override;
+    std::vector<std::shared_ptr<const AgentMessage>> get_history_tail(const std::string& context_id,
+                                                                      size_t max_length = 0) override;
+    bool delete_task(const std::string& task_id) override;
+    bool task_exists(const std::string& task_id) override;
+    
+    /**
+     * @brief Drop a task from the cache, e.g. after another process changed it
+     */
+    void invalidate(const std::string& task_id);
+    
+    /**
+     * @brief Drop every cached task
+     */
+    void clear();
+    
+    /**
+     * @brief The store behind the cache
+     */
+    ITaskStore& store() const;
+    
+    /**
+     * @brief Number of cached tasks and their approximate size in bytes
+     */
+    size_t size() const;
+    size_t bytes() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace a2a
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "../core/http_client.hpp"
+#include <string>
+#include <string_view>
+#include <map>
+#include <memory>
+#include <functional>
+
+namespace a2a {
+
+class TaskManager;
+
+namespace server {
+
+/**
+ * @brief Parsed HTTP/1.x request
+ */
+struct HttpRequest {
+    std::string method;
+    std::string path;
+    std::string query;
+    std::string version;
+    
+    /// Header names are lower-cased
+    std::map<std::string, std::string> headers;
+    
+    /// De-chunked request body
+    std::string body;
+    
+    /**
+     * @brief Look up a header by lower-case name
+     * @return Header value, or an empty string if absent
+     */
+    const std::string& header(const std::string& name) const;
+    
+    /**
+     * @brief Whether the connection stays open after this request
+     */
+    bool keep_alive() const;
+};
+
+/**
+ * @brief Listener and worker settings for HttpServer
+ */
+struct HttpServerOptions {
+    std::string host = "0.0.0.0";
+    
+    /// Port to listen on (0 picks an ephemeral port, see HttpServer::port())
+    int port = 8080;
+    
+    /// Handler threads (0 = hardware concurrency); open streams run on
+    /// threads of their own
+    size_t worker_threads = 0;
+    
+    int listen_backlog = 1024;
+    
+    size_t max_header_bytes = 64 * 1024;
+    size_t max_body_bytes = 16 * 1024 * 1024;
+    
+    /// Keep-alive connections idle longer than this are closed
+    int idle_timeout_seconds = 60;
+    
+    /// How long stop() waits for in-flight requests before closing them
+    int shutdown_timeout_seconds = 10;
+    
+    /// ResponseStream::write() blocks while more than this is unsent
+    size_t stream_high_water_bytes = 256 * 1024;
+    
+    /// Gzip responses at least this large for clients that accept it
+    /// (0 = never); event streams are compressed whatever their size
+    size_t compression_min_bytes = 1024;
+    int compression_level = DEFAULT_COMPRESSION_LEVEL;
+    
+    /// Cache-Control max-age sent with the agent card; clients revalidate
+    /// with If-None-Match after it expires
+    long agent_card_max_age_seconds = 300;
+};
+
+/**
+ * @brief Response written incrementally by a streaming handler
+ *
+ * Either respond() once, or begin() and then write() any number of
+ * chunks; the body ends when the handler returns. Each chunk is sent as
+ * soon as it is written (chunked transfer encoding). Calls may come from
+ * any thread, one at a time, until the handler returns.
+ */
+class ResponseStream {
+public:
+    virtual ~ResponseStream() = default;
+    
+    /**
+     * @brief Send the status line and headers; the body follows via write()
+     */
+    virtual void begin(int status, const std::map<std::string, std::string>& headers) = 0;
+    
+    /**
+     * @brief Send one chunk of the body
+     * Blocks while the client is behind by more than
+     * HttpServerOptions::stream_high_water_bytes.
+     * @return false once the client has gone away
+     */
+    virtual bool write(std::string_view data) = 0;
+    
+    /**
+     * @brief Send a complete, non-streamed response instead
+     */
+    virtual void respond(const HttpResponse& response) = 0;
+};
+
+/**
+ * @brief Embedded HTTP/1.1 server (Linux, epoll)
+ *
+ * One event-loop thread accepts connections and does all socket I/O;
+ * complete requests are handed to a fixed pool of worker threads, and
+ * response streams to a pool that grows with the number open. Bodies
+ * may use Content-Length or chunked transfer encoding, connections are
+ * kept alive, and pipelined requests are answered in order.
+ *
+ * Request bodies sent with Content-Encoding: gzip are inflated before the
+ * handler sees them. Responses, and text/event-stream bodies frame by
+ * frame, are gzipped when the client's Accept-Encoding allows it.
+ *
+ * Handlers run on those threads and must be thread-safe.
+ */
+class HttpServer {
+public:
+    /**
+     * @brief Request handler; a missing Content-Type defaults to JSON
+     */
+    using Handler = std::function<HttpResponse(const HttpRequest&)>;
+    
+    /**
+     * @brief Streaming request handler
+     */
+    using StreamHandler = std::function<void(const HttpRequest&, ResponseStream&)>;
+    
+    /**
+     * @brief Decides whether a request to a streaming route streams
+     */
+    using StreamPredicate = std::function<bool(const HttpRequest&)>;
+    
+    explicit HttpServer(const HttpServerOptions& options = HttpServerOptions());
+    
+    /**
+     * @brief Stops the server if it is still running
+     */
+    ~HttpServer();
+    
+    // Disable copy and move (worker threads refer to the server)
+    HttpServer(const HttpServer&) = delete;
+    HttpServer& operator=(const HttpServer&) = delete;
+    
+    /**
+     * @brief Register a handler for an exact method and path
+     * Must be called before start().
+     */
+    void route(const std::string& method, const std::string& path, Handler handler);
+    
+    /**
+     * @brief Register a streaming handler for an exact method and path
+     *
+     * The handler runs on a thread of its own rather than a worker, so open
+     * streams never hold up other requests. With @p streams, requests it
+     * turns down (it sees the decoded body) run the handler on a worker
+     * instead, and the handler must then respond() rather than stream.
+     * Must be called before start().
+     */
+    void route_stream(const std::string& method, const std::string& path, StreamHandler handler,
+                      StreamPredicate streams = nullptr);
+    
+    /**
+     * @brief Serve the A2A protocol from a TaskManager
+     *
+     * Registers the JSON-RPC endpoint (POST rpc_path) and the agent card
+     * (GET /.well-known/agent-card.json). message/stream and
+     * tasks/resubscribe are answered as Server-Sent Events, one JSON-RPC
+     * response per event. The agent card is served with an ETag and
+     * Cache-Control, and a matching If-None-Match gets 304 Not Modified.
+     * The task manager must outlive the server.
+     */
+    void mount(TaskManager& task_manager, const std::string& rpc_path = "/");
+    
+    /**
+     * @brief Bind, listen and start the event loop and workers
+     * Returns once the server is accepting connections.
+     * @throws A2AException if the socket cannot be set up
+     */
+    void start();
+    
+    /**
+     * @brief Stop accepting, finish in-flight requests, then shut down
+     * Blocks until all threads have exited. Safe to call more than once.
+     */
+    void stop();
+    
+    /**
+     * @brief Block until the server has been stopped
+     */
+    void wait();
+    
+    /**
+     * @brief Port actually bound (valid after start())
+     */
+    int port() const;
+    
+    bool is_running() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace server
+} // namespace a2a
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <a2a/core/wire_format.hpp>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <functional>
+
+namespace a2a {
+
+class TaskManager;
+
+namespace server {
+
+/**
+ * @brief Routes JSON-RPC 2.0 requests (single or batch) to method handlers
+ *
+ * Requests are parsed in one pass; params are handed to handlers as their
+ * original JSON text and each handler's result is spliced into the
+ * response verbatim. Batch members run concurrently on a worker pool and
+ * their responses are concatenated into the batch array in request order.
+ * Request ids are echoed with their original JSON type.
+ *
+ * Non-streaming requests may also arrive as CBOR and are answered in
+ * CBOR. The A2A methods decode and encode CBOR natively; results of
+ * handlers added with register_method() are converted from JSON.
+ */
+class JsonRpcDispatcher {
+public:
+    /**
+     * @brief Method handler
+     * Receives the raw params JSON (empty if absent) and returns the
+     * serialized result. Throw A2AException to answer with an error.
+     */
+    using MethodHandler = std::function<std::string(std::string_view params_json)>;
+    
+    /**
+     * @brief Streaming method handler
+     * Calls emit once per result (an empty string is a keep-alive tick) and
+     * returns when the stream ends. Throw A2AException to end it with an error.
+     */
+    using StreamHandler = std::function<void(std::string_view params_json,
+                                             const std::function<void(const std::string&)>& emit)>;
+    
+    /**
+     * @brief Receives each serialized response of a stream
+     * @return false if the peer is gone and the stream should stop
+     */
+    using StreamWriter = std::function<bool(const std::string& response_json)>;
+    
+    /**
+     * @param batch_threads Workers for batch requests (0 = hardware concurrency)
+     */
+    explicit JsonRpcDispatcher(size_t batch_threads = 0);
+    
+    ~JsonRpcDispatcher();
+    
+    // Disable copy and move (batch workers refer to the dispatcher)
+    JsonRpcDispatcher(const JsonRpcDispatcher&) = delete;
+    JsonRpcDispatcher& operator=(const JsonRpcDispatcher&) = delete;
+    
+    /**
+     * @brief Register (or replace) the handler for a method
+     * Must not be called concurrently with dispatch().
+     */
+    void register_method(const std::string& method, MethodHandler handler);
+    
+    /**
+     * @brief Register the A2A methods (A2AMethods) served by a TaskManager
+     * The task manager must outlive the dispatcher.
+     */
+    void register_task_manager(TaskManager& task_manager);
+    
+    /**
+     * @brief Register (or replace) a method answered with a stream of responses
+     * Must not be called concurrently with dispatch().
+     */
+    void register_stream_method(const std::string& method, StreamHandler handler);
+    
+    bool has_method(const std::string& method) const;
+    
+    /**
+     * @brief Handle a request body and build the response body
+     * @param format Encoding of the body; the response uses the same one
+     * @return Serialized response, or an empty string if every request was
+     *         a notification and no response must be sent
+     */
+    std::string dispatch(std::string_view body, WireFormat format = WireFormat::Json);
+    
+    /**
+     * @brief Whether a body is a single request for a streaming method
+     */
+    bool is_stream_request(std::string_view body) const;
+    
+    /**
+     * @brief Handle a streaming request
+     *
+     * Each result is wrapped in its own JSON-RPC response carrying the
+     * request id and passed to write; keep-alive ticks are passed as an
+     * empty string. A failure ends the stream with an error response.
+     */
+    void dispatch_stream(std::string_view body, const StreamWriter& write);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace server
+} // namespace a2a
@@ -1,23 +1,77 @@
 #pragma once
 
 #include "task_store.hpp"
-#include <map>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace a2a {
 
+/**
+ * @brief Limits and layout for MemoryTaskStore
+ */
+struct MemoryTaskStoreOptions {
+    /// Number of shards, rounded up to a power of two
+    /// (0 = scaled to hardware concurrency and max_tasks)
+    size_t shard_count = 0;
+    
+    /// Most tasks kept; least recently used are evicted first (0 = unbounded)
+    size_t max_tasks = 0;
+    
+    /// Approximate memory tasks may use; least recently used are evicted
+    /// first (0 = unbounded)
+    size_t max_bytes = 0;
+    
+    /// History messages kept per task, oldest dropped first (0 = unbounded)
+    size_t max_history = 0;
+    
+    /// How long a task is kept after reaching a terminal state (0 = forever)
+    std::chrono::milliseconds terminal_ttl{0};
+    
+    /// How often the background reaper removes expired tasks
+    std::chrono::milliseconds reap_interval{1000};
+};
+
 /**
  * @brief In-memory implementation of ITaskStore
- * Thread-safe using mutex
+ *
+ * Thread-safe. Tasks are hash-partitioned across shards, each guarded by
+ * its own reader-writer lock, so operations on different tasks rarely
+ * contend and lookups of the same task proceed in parallel.
+ *
+ * Tasks are held as shared snapshots: get_task_snapshot() is O(1), and an
+ * update copies a task only while an older snapshot of it is still held
+ * elsewhere (copy-on-write).
+ *
+ * Memory can be bounded: max_tasks and max_bytes are split evenly between
+ * the shards, each of which evicts its least recently used tasks (O(1)
+ * per access and per eviction) but never the task just written. Tasks in
+ * a terminal state are removed terminal_ttl after reaching it by a
+ * background thread, which holds each shard's lock for a short batch at
+ * a time; until then they stay readable.
  */
 class MemoryTaskStore : public ITaskStore {
 public:
-    MemoryTaskStore() = default;
-    ~MemoryTaskStore() override = default;
+    /**
+     * @param shard_count Number of shards, rounded up to a power of two
+     *        (0 = scaled to hardware concurrency)
+     */
+    explicit MemoryTaskStore(size_t shard_count = 0);
+    explicit MemoryTaskStore(const MemoryTaskStoreOptions& options);
+    ~MemoryTaskStore() override;
     
     // ITaskStore implementation
     std::optional<AgentTask> get_task(const std::string& task_id) override;
     
+    std::shared_ptr<const AgentTask> get_task_snapshot(const std::string& task_id) override;
+    
     void set_task(const AgentTask& task) override;
     
     void update_status(const std::string& task_id,
@@ -33,6 +87,9 @@ public:
     std::vector<AgentMessage> get_history(const std::string& context_id,
                                           int max_length = 0) override;
     
+    std::vector<std::shared_ptr<const AgentMessage>> get_history_tail(const std::string& context_id,
+                                                                      size_t max_length = 0) override;
+    
     bool delete_task(const std::string& task_id) override;
     
     bool task_exists(const std::string& task_id) override;
@@ -42,14 +99,98 @@ public:
      */
     size_t size() const;
     
+    /**
+     * @brief Approximate memory used by the stored tasks
+     */
+    size_t bytes() const;
+    
     /**
      * @brief Clear all tasks
      */
     void clear();
+    
+    /**
+     * @brief Remove terminal tasks older than terminal_ttl now, rather than
+     * waiting for the reaper
+     * @return Number of tasks removed
+     */
+    size_t remove_expired();
+    
+    size_t shard_count() const { return shard_mask_ + 1; }
 
 private:
-    mutable std::mutex mutex_;
-    std::map<std::string, AgentTask> tasks_;
+    using Clock = std::chrono::steady_clock;
+    
+    struct Entry {
+        std::shared_ptr<AgentTask> task;
+        size_t bytes = 0;
+        std::list<const std::string*>::iterator lru;  ///< Points at the map key
+        Clock::time_point terminal_since;             ///< Only meaningful while terminal
+    };
+    
+    using Tasks = std::unordered_map<std::string, Entry>;
+    
+    // One cache line per shard keeps neighbouring locks from false sharing
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        Tasks tasks;
+        size_t bytes = 0;
+        
+        // Most recently used first. Readers reorder it under their shared
+        // lock, so it has a mutex of its own
+        std::list<const std::string*> lru;
+        std::mutex lru_mutex;
+        
+        // Tasks in the order they became terminal; entries whose task has
+        // since changed are skipped when they come due
+        std::deque<std::pair<Clock::time_point, std::string>> expiring;
+    };
+    
+    // Task to modify in place, detached first from any outstanding snapshot
+    static AgentTask& writable(std::shared_ptr<AgentTask>& task) {
+        if (task.use_count() > 1) {
+            task = std::make_shared<AgentTask>(*task);
+        } else {
+            // use_count() is a relaxed load: order the last reader's accesses
+            // before our writes
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *task;
+    }
+    
+    Shard& shard_for(const std::string& task_id) const {
+        return shards_[std::hash<std::string>{}(task_id) & shard_mask_];
+    }
+    
+    bool bounded() const { return shard_max_tasks_ != 0 || shard_max_bytes_ != 0; }
+    
+    // Mark an entry most recently used (shard lock held, shared or exclusive)
+    void touch(Shard& shard, Entry& entry) const;
+    
+    // Record a status change and the entry's new size (exclusive lock held)
+    void updated(Shard& shard, Entry& entry, bool was_terminal, size_t bytes) const;
+    
+    // Evict least recently used tasks over the shard's budget, sparing the
+    // most recent one (exclusive lock held)
+    void evict(Shard& shard) const;
+    
+    void erase(Shard& shard, Tasks::iterator it) const;
+    
+    size_t remove_expired(Shard& shard, Clock::time_point now);
+    
+    void reap();
+    
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_mask_;
+    
+    MemoryTaskStoreOptions options_;
+    size_t shard_max_tasks_ = 0;
+    size_t shard_max_bytes_ = 0;
+    
+    std::mutex reaper_mutex_;
+    std::condition_variable reaper_wakeup_;
+    bool reaper_stopping_ = false;
+    std::thread reaper_;
 };
 
 } // namespace a2a
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "task_store.hpp"
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace a2a {
+
+/**
+ * @brief Connection and layout settings for RedisTaskStore
+ */
+struct RedisTaskStoreOptions {
+    std::string host = "127.0.0.1";
+    int port = 6379;
+    
+    /// AUTH password and SELECT database (empty / 0 = none)
+    std::string password;
+    int database = 0;
+    
+    std::chrono::milliseconds connect_timeout{2000};
+    std::chrono::milliseconds command_timeout{2000};
+    
+    /// Prepended to every key, so several deployments can share a server
+    std::string key_prefix = "a2a:";
+    
+    /// History messages kept per task, oldest dropped first (0 = unbounded)
+    size_t max_history = 0;
+    
+    /// Connections in the pool; each task is served by one of them
+    size_t connections = 4;
+    
+    /// Most commands sent to one connection in a single round trip
+    size_t max_pipeline = 256;
+    
+    /// Announce every write on the channel "<key_prefix>changes", for
+    /// subscribe_changes() in other processes
+    bool publish_changes = false;
+};
+
+/**
+ * @brief Redis-based TaskStore for agents that share tasks across processes
+ *
+ * Each task is a hash holding its scalar fields (id, contextId, status,
+ * metadata) next to two lists for its artifacts and history:
+ *
+ *     <prefix>task:{<id>}            HASH  id, contextId, status, metadata
+ *     <prefix>task:{<id>}:artifacts  LIST  artifact JSON, in order
+ *     <prefix>task:{<id>}:history    LIST  message JSON, in order
+ *
+ * Updates touch only their own field or list and run as server-side
+ * scripts that first check the task exists, so update_status(),
+ * add_artifact() and add_history_message() are one round trip whatever
+ * the task's size, and concurrent writers never overwrite each other's
+ * changes. get_task() and set_task() are atomic as well. The braces are
+ * a Redis Cluster hash tag keeping a task's keys in one slot.
+ *
+ * Commands go through a pool of connections, each with a thread that
+ * pipelines whatever has queued up since its last round trip, so many
+ * concurrent callers share a few round trips instead of each waiting for
+ * its own. All commands about one task use the same connection and run
+ * in the order they were issued. The *_async() methods queue a command
+ * and return at once; the command runs whether or not the future is
+ * waited on, and its errors are thrown from the future's get().
+ *
+ * Requires hiredis; built when A2A_WITH_REDIS is enabled. Thread-safe.
+ *
+ * @throws A2AException with ErrorCode::InternalError from the constructor
+ *         and every operation if Redis cannot be reached or fails
+ */
+class RedisTaskStore : public ITaskStore {
+public:
+    explicit RedisTaskStore(const RedisTaskStoreOptions& options = RedisTaskStoreOptions());
+    RedisTaskStore(const std::string& host, int port = 6379);
+    
+    ~RedisTaskStore() override;
+    
+    // Disable copy, enable move
+    RedisTaskStore(const RedisTaskStore&) = delete;
+    RedisTaskStore& operator=(const RedisTaskStore&) = delete;
+    RedisTaskStore(RedisTaskStore&&) noexcept;
+    RedisTaskStore& operator=(RedisTaskStore&&) noexcept;
+    
+    // ITaskStore interface implementation
+    std::optional<AgentTask> get_task(const std::string& task_id) override;
+    void set_task(const AgentTask& task) override;
+    void update_status(const std::string& task_id,
+                      TaskState status,
+                      const std::string& message = "") override;
+    void add_artifact(const std::string& task_id,
+                     const Artifact& artifact) override;
+    void add_history_message(const std::string& task_id,
+                            const AgentMessage& message) override;
+    std::vector<AgentMessage> get_history(const std::string& context_id,
+                                          int max_length = 0) override;
+    bool delete_task(const std::string& task_id) override;
+    bool task_exists(const std::string& task_id) override;
+    
+    // Pipelined variants of the operations above
+    std::future<std::optional<AgentTask>> get_task_async(const std::string& task_id);
+    std::future<void> set_task_async(const AgentTask& task);
+    std::future<void> update_status_async(const std::string& task_id,
+                                          TaskState status,
+                                          const std::string& message = "");
+    std::future<void> add_artifact_async(const std::string& task_id,
+                                         const Artifact& artifact);
+    std::future<void> add_history_message_async(const std::string& task_id,
+                                                const AgentMessage& message);
+    
+    /**
+     * @brief Watch for tasks written by other RedisTaskStore instances
+     *
+     * Opens a dedicated connection subscribed to the changes channel and
+     * calls @p on_change, on its own thread, with the id of each task
+     * written by an instance that has publish_changes enabled; this
+     * instance's own writes are skipped. If the subscription is lost it
+     * is restored, and @p on_change is called with an empty id because
+     * any task may have changed meanwhile. Calling again replaces the
+     * callback.
+     */
+    void subscribe_changes(std::function<void(const std::string& task_id)> on_change);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace a2a
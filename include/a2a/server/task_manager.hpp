@@ -6,12 +6,39 @@
 #include "../models/agent_message.hpp"
 #include "../models/message_send_params.hpp"
 #include "../models/a2a_response.hpp"
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
 
 namespace a2a {
 
+/**
+ * @brief Buffering and keep-alive settings for streamed task events
+ */
+struct TaskStreamOptions {
+    /// Events queued per stream before producers wait (status updates coalesce instead)
+    size_t max_queued_events = 256;
+    
+    /// How long a producer waits for room in a full stream; a stream still
+    /// full after that is lagging and ends early, without its final event
+    /// (the client may resubscribe)
+    std::chrono::milliseconds max_publish_wait{1000};
+    
+    /// An empty keep-alive event is delivered after this long without events
+    std::chrono::milliseconds heartbeat_interval{15000};
+};
+
+/**
+ * @brief Agent card serialized once for serving
+ */
+struct AgentCardDocument {
+    std::string json;
+    
+    /// Strong entity tag (quoted) derived from json, for conditional GETs
+    std::string etag;
+};
+
 /**
  * @brief Task Manager - manages the complete lifecycle of agent tasks
  */
@@ -23,6 +50,11 @@ public:
      */
     using MessageCallback = std::function<A2AResponse(const MessageSendParams&)>;
     
+    /**
+     * @brief Callback type for message received, with the message undecoded
+     */
+    using MessageViewCallback = std::function<A2AResponse(const MessageSendParamsView&)>;
+    
     /**
      * @brief Callback type for task lifecycle events
      */
@@ -54,6 +86,16 @@ public:
      */
     void set_on_message_received(MessageCallback callback);
     
+    /**
+     * @brief Set a handler that receives message/send requests as views
+     *
+     * For agents that route or forward messages without reading every
+     * part: parts are decoded only if the handler asks for them. Takes
+     * over non-streaming requests from the set_on_message_received()
+     * handler, which still serves streaming ones.
+     */
+    void set_on_message_view_received(MessageViewCallback callback);
+    
     /**
      * @brief Set callback for when a task is created
      */
@@ -71,9 +113,23 @@ public:
     
     /**
      * @brief Set callback for agent card queries
+     *
+     * The card it returns is serialized once per agent URL and served
+     * from cache until invalidate_agent_card() is called.
      */
     void set_on_agent_card_query(AgentCardCallback callback);
     
+    /**
+     * @brief Drop cached agent cards so the next query rebuilds them
+     * Call after anything the card callback depends on has changed.
+     */
+    void invalidate_agent_card();
+    
+    /**
+     * @brief Configure event streams started after this call
+     */
+    void set_stream_options(const TaskStreamOptions& options);
+    
     // === Task Operations ===
     
     /**
@@ -93,6 +149,14 @@ public:
      */
     AgentTask get_task(const std::string& task_id);
     
+    /**
+     * @brief Get a shared, immutable snapshot of a task without copying it
+     * @param task_id Task identifier
+     * @return Task snapshot (never null)
+     * @throws A2AException if not found
+     */
+    std::shared_ptr<const AgentTask> get_task_snapshot(const std::string& task_id);
+    
     /**
      * @brief Cancel a task
      * @param task_id Task identifier
@@ -128,14 +192,42 @@ public:
      */
     A2AResponse send_message(const MessageSendParams& params);
     
+    /**
+     * @brief Process a message (non-streaming) given as a view
+     *
+     * Goes to the view handler if one is set; otherwise the message is
+     * decoded and handled as by send_message(const MessageSendParams&).
+     * @param resource Memory resource for any decoded message parts
+     */
+    A2AResponse send_message(const MessageSendParamsView& params,
+                             std::pmr::memory_resource* resource = nullptr);
+    
     /**
      * @brief Process a message (streaming)
+     *
+     * The first event is the Task or Message returned by the message
+     * handler. For a Task, every update_status() / return_artifact() on it
+     * (including those made by the handler itself, or by tasks it creates
+     * via create_task() on the calling thread) follows as a
+     * TaskStatusUpdateEvent / TaskArtifactUpdateEvent until the returned
+     * task's final status; other tasks' final statuses do not end the
+     * stream. Blocks until then, or until the stream falls too far behind
+     * (see TaskStreamOptions::max_publish_wait). An empty string is a
+     * keep-alive tick; the callback may throw to end the stream early.
      * @param params Message parameters
-     * @param callback Called for each event
+     * @param callback Called for each event (JSON)
      */
     void send_message_streaming(const MessageSendParams& params,
                                std::function<void(const std::string&)> callback);
     
+    /**
+     * @brief Stream an existing task's updates
+     * Emits the current Task, then its events as in send_message_streaming().
+     * @throws A2AException if the task is not found
+     */
+    void resubscribe(const std::string& task_id,
+                     std::function<void(const std::string&)> callback);
+    
     /**
      * @brief Get agent card
      * @param agent_url Agent URL
@@ -143,6 +235,12 @@ public:
      */
     AgentCard get_agent_card(const std::string& agent_url);
     
+    /**
+     * @brief Get the serialized agent card and its ETag (cached)
+     * @param agent_url Agent URL
+     */
+    std::shared_ptr<const AgentCardDocument> get_agent_card_document(const std::string& agent_url);
+    
     /**
      * @brief Get the task store
      * @return Shared pointer to task store
@@ -21,6 +21,24 @@ public:
      */
     virtual std::optional<AgentTask> get_task(const std::string& task_id) = 0;
     
+    /**
+     * @brief Retrieve a shared, immutable snapshot of a task
+     *
+     * Later updates never modify a snapshot already handed out, so it may
+     * be read without locking. Stores that keep tasks behind shared
+     * pointers return them without copying; the default copies the task
+     * via get_task().
+     * @param task_id Task identifier
+     * @return Snapshot, or nullptr if not found
+     */
+    virtual std::shared_ptr<const AgentTask> get_task_snapshot(const std::string& task_id) {
+        auto task = get_task(task_id);
+        if (!task.has_value()) {
+            return nullptr;
+        }
+        return std::make_shared<const AgentTask>(std::move(*task));
+    }
+    
     /**
      * @brief Store or update a task
      * @param task Task to store
@@ -62,6 +80,25 @@ public:
     virtual std::vector<AgentMessage> get_history(const std::string& context_id,
                                                    int max_length = 0) = 0;
     
+    /**
+     * @brief Get the newest history messages as shared, immutable messages
+     *
+     * Stores that keep history in a MessageHistory return the stored
+     * messages in O(max_length) without copying them; the default copies
+     * via get_history().
+     * @param context_id Context identifier (or task_id)
+     * @param max_length Maximum number of messages to return (0 = all)
+     * @return Messages, oldest first
+     */
+    virtual std::vector<std::shared_ptr<const AgentMessage>> get_history_tail(const std::string& context_id,
+                                                                              size_t max_length = 0) {
+        std::vector<std::shared_ptr<const AgentMessage>> messages;
+        for (auto& message : get_history(context_id, static_cast<int>(max_length))) {
+            messages.push_back(std::make_shared<const AgentMessage>(std::move(message)));
+        }
+        return messages;
+    }
+    
     /**
      * @brief Delete a task
      * @param task_id Task identifier
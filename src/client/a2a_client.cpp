@@ -2,17 +2,60 @@
 #include <a2a/core/jsonrpc_request.hpp>
 #include <a2a/core/jsonrpc_response.hpp>
 #include <a2a/core/a2a_methods.hpp>
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/json_writer.hpp>
+#include <a2a/core/sse_parser.hpp>
 #include <a2a/core/exception.hpp>
-#include <sstream>
+#include <a2a/core/id_generator.hpp>
+#include <cstdlib>
+#include <optional>
 
 namespace a2a {
 
-// Helper to generate UUID (simplified)
-static std::string generate_uuid() {
-    static int counter = 0;
-    std::ostringstream oss;
-    oss << "req-" << ++counter << "-" << std::time(nullptr);
-    return oss.str();
+// A result is a Task if it carries a top-level "status" (or kind "task")
+static bool is_task_result(std::string_view result, WireFormat format) {
+    JsonReader reader(result, format);
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "status") {
+            return true;
+        }
+        if (key == "kind" && reader.peek() == JsonReader::Type::String) {
+            if (reader.read_string_view() == "task") {
+                return true;
+            }
+            continue;
+        }
+        reader.skip_value();
+    }
+    return false;
+}
+
+// Request object with params encoded straight into the envelope
+template<typename Params>
+static void write_request(JsonWriter& writer, std::string_view id, std::string_view method,
+                          const Params& params) {
+    writer.begin_object();
+    writer.string_field("jsonrpc", "2.0");
+    writer.string_field("id", id);
+    writer.string_field("method", method);
+    writer.key("params");
+    params.write_json(writer);
+    writer.end_object();
+}
+
+template<typename Model>
+static Model read_result(std::string_view result, WireFormat format) {
+    JsonReader reader(result, format);
+    return Model::read_json(reader);
+}
+
+// Format of a response body, from its Content-Type
+static WireFormat response_format(const HttpResponse& http_response) {
+    auto it = http_response.headers.find("content-type");
+    return it == http_response.headers.end() ? WireFormat::Json
+                                             : wire_format_from_content_type(it->second);
 }
 
 // PIMPL implementation
@@ -29,21 +72,75 @@ public:
     
     std::string base_url_;
     HttpClient http_client_;
+    WireFormat format_ = WireFormat::Json;
+    
+    template<typename Params>
+    std::string encode_request(const std::string& method, const Params& params) const {
+        std::string out;
+        JsonWriter writer(out, format_);
+        write_request(writer, generate_id(), method, params);
+        return out;
+    }
     
     // Helper to send JSON-RPC request
-    JsonRpcResponse send_rpc_request(const std::string& method,
-                                    const std::string& params_json) {
-        // Create JSON-RPC request
-        JsonRpcRequest request(generate_uuid(), method, params_json);
-        std::string request_json = request.to_json();
-        
+    // Returns the "result" member as a span into response_body, which the
+    // caller owns; the payload is never re-serialized or copied. It is in
+    // result_format, the format the server answered in.
+    template<typename Params>
+    std::string_view send_rpc_request(const std::string& method,
+                                      const Params& params,
+                                      std::string& response_body,
+                                      WireFormat& result_format) {
         // Send HTTP POST
         auto http_response = http_client_.post(
+            base_url_,
+            encode_request(method, params),
+            std::string(content_type(format_))
+        );
+        
+        return extract_result(http_response, response_body, result_format);
+    }
+    
+    // Send a streaming JSON-RPC request and pass on the data of each
+    // Server-Sent Event (one JSON-RPC response) as it completes
+    void stream_rpc_request(const std::string& method,
+                            std::string params_json,
+                            const std::function<void(std::string_view)>& on_response) {
+        JsonRpcRequest request(generate_id(), method, std::move(params_json));
+        std::string request_json = request.to_json();
+        
+        SseParser parser([&on_response](const SseEvent& event) {
+            if (event.event == "message" && !event.data.empty()) {
+                on_response(event.data);
+            }
+        });
+        
+        http_client_.post_stream_chunks(
             base_url_,
             request_json,
-            "application/json"
+            "application/json",
+            [&parser](std::string_view chunk) { parser.feed(chunk); }
         );
+    }
+    
+    // Unwrap one streamed JSON-RPC response into a typed event
+    static void deliver_event(std::string_view response_json, const StreamEventCallback& callback) {
+        auto rpc_response = JsonRpcResponseView::parse(response_json);
         
+        if (rpc_response.is_error()) {
+            const auto& error = *rpc_response.error();
+            throw A2AException(error.message, static_cast<ErrorCode>(error.code));
+        }
+        if (rpc_response.result().has_value()) {
+            callback(StreamEvent::from_json(*rpc_response.result()));
+        }
+    }
+    
+    // Validate an HTTP response carrying a JSON-RPC envelope and return its
+    // "result" as a span into response_body (which takes over the body)
+    static std::string_view extract_result(HttpResponse& http_response,
+                                           std::string& response_body,
+                                           WireFormat& result_format) {
         // Check HTTP status
         if (!http_response.is_success()) {
             throw A2AException(
@@ -52,8 +149,11 @@ public:
             );
         }
         
-        // Parse JSON-RPC response
-        JsonRpcResponse rpc_response = JsonRpcResponse::from_json(http_response.body);
+        response_body = std::move(http_response.body);
+        result_format = response_format(http_response);
+        
+        // Parse JSON-RPC envelope
+        auto rpc_response = JsonRpcResponseView::parse(response_body, result_format);
         
         // Check for JSON-RPC error
         if (rpc_response.is_error()) {
@@ -64,7 +164,19 @@ public:
             );
         }
         
-        return rpc_response;
+        if (!rpc_response.result().has_value()) {
+            throw A2AException("No result in response", ErrorCode::InternalError);
+        }
+        
+        return *rpc_response.result();
+    }
+    
+    // Determine if a message/send result is a Task or a Message
+    static A2AResponse to_send_response(std::string_view result, WireFormat format) {
+        if (is_task_result(result, format)) {
+            return A2AResponse(read_result<AgentTask>(result, format));
+        }
+        return A2AResponse(read_result<AgentMessage>(result, format));
     }
 };
 
@@ -77,30 +189,41 @@ A2AClient::A2AClient(A2AClient&&) noexcept = default;
 A2AClient& A2AClient::operator=(A2AClient&&) noexcept = default;
 
 A2AResponse A2AClient::send_message(const MessageSendParams& params) {
-    // Serialize params to JSON
-    std::string params_json = params.to_json();
-    
     // Send JSON-RPC request
-    auto response = impl_->send_rpc_request(A2AMethods::MESSAGE_SEND, params_json);
+    std::string body;
+    WireFormat format;
+    std::string_view result = impl_->send_rpc_request(
+        A2AMethods::MESSAGE_SEND, params, body, format);
     
-    // Parse result
-    if (!response.result_json().has_value()) {
-        throw A2AException("No result in response", ErrorCode::InternalError);
-    }
+    return Impl::to_send_response(result, format);
+}
+
+std::future<A2AResponse> A2AClient::send_message_async(const MessageSendParams& params) {
+    auto promise = std::make_shared<std::promise<A2AResponse>>();
+    std::future<A2AResponse> future = promise->get_future();
     
-    const std::string& result_json = *response.result_json();
-    
-    // Determine if result is Task or Message
-    // Check for "kind" field or "status" field to distinguish
-    if (result_json.find("\"status\":") != std::string::npos) {
-        // It's a Task
-        AgentTask task = AgentTask::from_json(result_json);
-        return A2AResponse(task);
-    } else {
-        // It's a Message
-        AgentMessage message = AgentMessage::from_json(result_json);
-        return A2AResponse(message);
-    }
+    // The response is decoded on the HTTP event-loop thread
+    impl_->http_client_.post_async(
+        impl_->base_url_,
+        impl_->encode_request(A2AMethods::MESSAGE_SEND, params),
+        std::string(content_type(impl_->format_)),
+        [promise](HttpResponse http_response, std::exception_ptr error) {
+            if (error) {
+                promise->set_exception(error);
+                return;
+            }
+            try {
+                std::string body;
+                WireFormat format;
+                std::string_view result = Impl::extract_result(http_response, body, format);
+                promise->set_value(Impl::to_send_response(result, format));
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        }
+    );
+    
+    return future;
 }
 
 void A2AClient::send_message_streaming(const MessageSendParams& params,
@@ -108,51 +231,117 @@ void A2AClient::send_message_streaming(const MessageSendParams& params,
     // Serialize params to JSON
     std::string params_json = params.to_json();
     
-    // Create JSON-RPC request
-    JsonRpcRequest request(generate_uuid(), A2AMethods::MESSAGE_STREAM, params_json);
-    std::string request_json = request.to_json();
-    
-    // Send streaming POST request
-    impl_->http_client_.post_stream(
-        impl_->base_url_,
-        request_json,
-        "application/json",
-        callback
-    );
+    // One buffer is reused for every event handed to the callback
+    std::string event_json;
+    impl_->stream_rpc_request(A2AMethods::MESSAGE_STREAM, std::move(params_json),
+        [&event_json, &callback](std::string_view response_json) {
+            event_json.assign(response_json.data(), response_json.size());
+            callback(event_json);
+        });
+}
+
+void A2AClient::send_message_streaming(const MessageSendParams& params,
+                                       const StreamEventCallback& callback) {
+    impl_->stream_rpc_request(A2AMethods::MESSAGE_STREAM, params.to_json(),
+        [&callback](std::string_view response_json) {
+            Impl::deliver_event(response_json, callback);
+        });
 }
 
 AgentTask A2AClient::get_task(const std::string& task_id) {
     // Create params
     TaskIdParams params;
     params.id = task_id;
-    std::string params_json = params.to_json();
     
     // Send JSON-RPC request
-    auto response = impl_->send_rpc_request(A2AMethods::TASK_GET, params_json);
+    std::string body;
+    WireFormat format;
+    std::string_view result = impl_->send_rpc_request(
+        A2AMethods::TASK_GET, params, body, format);
+    
+    return read_result<AgentTask>(result, format);
+}
+
+std::vector<AgentTask> A2AClient::get_tasks(const std::vector<std::string>& task_ids) {
+    if (task_ids.empty()) {
+        return {};
+    }
+    
+    // Member ids are the positions in task_ids, so replies can arrive in any order
+    std::string request_body;
+    JsonWriter writer(request_body, impl_->format_);
+    writer.begin_array();
+    for (size_t i = 0; i < task_ids.size(); ++i) {
+        TaskQueryParams params;
+        params.id = task_ids[i];
+        write_request(writer, std::to_string(i), A2AMethods::TASK_GET, params);
+    }
+    writer.end_array();
+    
+    auto http_response = impl_->http_client_.post(
+        impl_->base_url_,
+        request_body,
+        std::string(content_type(impl_->format_))
+    );
+    
+    if (!http_response.is_success()) {
+        throw A2AException(
+            "HTTP request failed: " + std::to_string(http_response.status_code),
+            ErrorCode::InternalError
+        );
+    }
+    
+    std::vector<std::optional<AgentTask>> tasks(task_ids.size());
+    
+    WireFormat format = response_format(http_response);
+    JsonReader reader(http_response.body, format);
+    if (reader.peek() != JsonReader::Type::Array) {
+        // A single error object answers a batch the server rejected outright
+        auto rpc_response = JsonRpcResponseView::parse(http_response.body, format);
+        const std::string message = rpc_response.is_error() ? rpc_response.error()->message
+                                                            : "Expected batch response";
+        throw A2AException(message, ErrorCode::InternalError);
+    }
     
-    // Parse result
-    if (!response.result_json().has_value()) {
-        throw A2AException("No result in response", ErrorCode::InternalError);
+    reader.begin_array();
+    while (reader.next_element()) {
+        auto rpc_response = JsonRpcResponseView::parse(reader.read_raw(), format);
+        
+        if (rpc_response.is_error()) {
+            const auto& error = *rpc_response.error();
+            throw A2AException(error.message, static_cast<ErrorCode>(error.code));
+        }
+        
+        size_t index = static_cast<size_t>(std::strtoul(rpc_response.id().c_str(), nullptr, 10));
+        if (index < tasks.size() && rpc_response.result().has_value()) {
+            tasks[index] = read_result<AgentTask>(*rpc_response.result(), format);
+        }
     }
     
-    return AgentTask::from_json(*response.result_json());
+    std::vector<AgentTask> result;
+    result.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (!tasks[i].has_value()) {
+            throw A2AException("No result for task: " + task_ids[i], ErrorCode::InternalError);
+        }
+        result.push_back(std::move(*tasks[i]));
+    }
+    
+    return result;
 }
 
 AgentTask A2AClient::cancel_task(const std::string& task_id) {
     // Create params
     TaskIdParams params;
     params.id = task_id;
-    std::string params_json = params.to_json();
     
     // Send JSON-RPC request
-    auto response = impl_->send_rpc_request(A2AMethods::TASK_CANCEL, params_json);
+    std::string body;
+    WireFormat format;
+    std::string_view result = impl_->send_rpc_request(
+        A2AMethods::TASK_CANCEL, params, body, format);
     
-    // Parse result
-    if (!response.result_json().has_value()) {
-        throw A2AException("No result in response", ErrorCode::InternalError);
-    }
-    
-    return AgentTask::from_json(*response.result_json());
+    return read_result<AgentTask>(result, format);
 }
 
 void A2AClient::subscribe_to_task(const std::string& task_id,
@@ -162,21 +351,31 @@ void A2AClient::subscribe_to_task(const std::string& task_id,
     params.id = task_id;
     std::string params_json = params.to_json();
     
-    // Create JSON-RPC request
-    JsonRpcRequest request(generate_uuid(), A2AMethods::TASK_SUBSCRIBE, params_json);
-    std::string request_json = request.to_json();
+    std::string event_json;
+    impl_->stream_rpc_request(A2AMethods::TASK_SUBSCRIBE, std::move(params_json),
+        [&event_json, &callback](std::string_view response_json) {
+            event_json.assign(response_json.data(), response_json.size());
+            callback(event_json);
+        });
+}
+
+void A2AClient::subscribe_to_task(const std::string& task_id,
+                                  const StreamEventCallback& callback) {
+    TaskIdParams params;
+    params.id = task_id;
     
-    // Send streaming POST request
-    impl_->http_client_.post_stream(
-        impl_->base_url_,
-        request_json,
-        "application/json",
-        callback
-    );
+    impl_->stream_rpc_request(A2AMethods::TASK_SUBSCRIBE, params.to_json(),
+        [&callback](std::string_view response_json) {
+            Impl::deliver_event(response_json, callback);
+        });
 }
 
 void A2AClient::set_timeout(long seconds) {
     impl_->http_client_.set_timeout(seconds);
 }
 
+void A2AClient::set_wire_format(WireFormat format) {
+    impl_->format_ = format;
+}
+
 } // namespace a2a
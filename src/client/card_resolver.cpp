@@ -1,8 +1,48 @@
 #include <a2a/client/card_resolver.hpp>
 #include <a2a/core/exception.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
 
 namespace a2a {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Freshness lifetime from a Cache-Control value; nullopt if it forbids storing
+std::optional<std::chrono::seconds> max_age(std::string_view cache_control) {
+    std::chrono::seconds age{0};
+    while (!cache_control.empty()) {
+        size_t comma = cache_control.find(',');
+        std::string_view directive = cache_control.substr(0, comma);
+        cache_control = comma == std::string_view::npos ? std::string_view()
+                                                        : cache_control.substr(comma + 1);
+        
+        while (!directive.empty() && directive.front() == ' ') {
+            directive.remove_prefix(1);
+        }
+        if (directive.substr(0, 8) == "no-store") {
+            return std::nullopt;
+        }
+        if (directive.substr(0, 8) == "no-cache") {
+            // Stored, but revalidated before every use
+            return std::chrono::seconds(0);
+        }
+        if (directive.substr(0, 8) == "max-age=") {
+            age = std::chrono::seconds(std::strtol(std::string(directive.substr(8)).c_str(), nullptr, 10));
+        }
+    }
+    return std::max(age, std::chrono::seconds(0));
+}
+
+const std::string* find_header(const HttpResponse& response, const std::string& name) {
+    auto it = response.headers.find(name);
+    return it == response.headers.end() ? nullptr : &it->second;
+}
+
+} // namespace
+
 // PIMPL implementation
 class A2ACardResolver::Impl {
 public:
@@ -27,8 +67,54 @@ public:
     std::string agent_card_path_;
     std::string agent_card_url_;
     HttpClient http_client_;
+    
+    // Cached card, guarded by mutex_ (held across the fetch)
+    std::mutex mutex_;
+    std::optional<AgentCard> card_;
+    std::string etag_;
+    Clock::time_point expires_;
+    std::optional<std::chrono::seconds> ttl_;
+    
+    AgentCard fetch();
 };
 
+AgentCard A2ACardResolver::Impl::fetch() {
+    std::map<std::string, std::string> headers;
+    if (card_ && !etag_.empty()) {
+        headers["If-None-Match"] = etag_;
+    }
+    
+    // Perform GET request
+    auto response = http_client_.get(agent_card_url_, headers);
+    
+    // Check response status
+    bool not_modified = response.status_code == 304 && card_;
+    if (!not_modified && !response.is_success()) {
+        throw A2AException(
+            "Failed to fetch agent card: HTTP " + std::to_string(response.status_code),
+            ErrorCode::InternalError
+        );
+    }
+    
+    if (!not_modified) {
+        // Parse JSON response
+        card_ = AgentCard::from_json(response.body);
+        const std::string* etag = find_header(response, "etag");
+        etag_ = etag ? *etag : std::string();
+    }
+    
+    const std::string* cache_control = find_header(response, "cache-control");
+    std::optional<std::chrono::seconds> lifetime =
+        ttl_ ? ttl_ : max_age(cache_control ? *cache_control : std::string_view());
+    if (!lifetime) {
+        AgentCard card = std::move(*card_);
+        card_.reset();
+        return card;
+    }
+    expires_ = Clock::now() + *lifetime;
+    return *card_;
+}
+
 A2ACardResolver::A2ACardResolver(const std::string& base_url,
                                  const std::string& agent_card_path)
     : impl_(std::make_unique<Impl>(base_url, agent_card_path)) {}
@@ -39,23 +125,13 @@ A2ACardResolver::A2ACardResolver(A2ACardResolver&&) noexcept = default;
 A2ACardResolver& A2ACardResolver::operator=(A2ACardResolver&&) noexcept = default;
 
 AgentCard A2ACardResolver::get_agent_card() {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    if (impl_->card_ && Clock::now() < impl_->expires_) {
+        return *impl_->card_;
+    }
+    
     try {
-        // Perform GET request
-        auto response = impl_->http_client_.get(impl_->agent_card_url_);
-        
-        // Check response status
-        if (!response.is_success()) {
-            throw A2AException(
-                "Failed to fetch agent card: HTTP " + std::to_string(response.status_code),
-                ErrorCode::InternalError
-            );
-        }
-        
-        // Parse JSON response
-        AgentCard card = AgentCard::from_json(response.body);
-        
-        return card;
-        
+        return impl_->fetch();
     } catch (const A2AException&) {
         throw;
     } catch (const std::exception& e) {
@@ -66,6 +142,19 @@ AgentCard A2ACardResolver::get_agent_card() {
     }
 }
 
+void A2ACardResolver::set_cache_ttl(std::optional<std::chrono::seconds> ttl) {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->ttl_ = ttl;
+    // Applies from the next call
+    impl_->expires_ = Clock::time_point();
+}
+
+void A2ACardResolver::invalidate() {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->card_.reset();
+    impl_->etag_.clear();
+}
+
 std::string A2ACardResolver::get_agent_card_url() const {
     return impl_->agent_card_url_;
 }
@@ -0,0 +1,367 @@
+#include <a2a/core/base64.hpp>
+#include <a2a/core/exception.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define A2A_BASE64_X86 1
+#include <immintrin.h>
+#endif
+
+namespace a2a {
+
+namespace {
+
+constexpr char kAlphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789+/";
+
+// Decode table markers; every other entry is a sextet value below 64
+constexpr uint8_t kInvalid = 0xFF;
+constexpr uint8_t kSpace = 0xFE;
+constexpr uint8_t kPad = 0xFD;
+
+struct DecodeTable {
+    uint8_t values[256] = {};
+    
+    constexpr DecodeTable() {
+        for (int c = 0; c < 256; ++c) {
+            values[c] = kInvalid;
+        }
+        for (int v = 0; v < 64; ++v) {
+            values[static_cast<uint8_t>(kAlphabet[v])] = static_cast<uint8_t>(v);
+        }
+        values[static_cast<uint8_t>(' ')] = kSpace;
+        values[static_cast<uint8_t>('\t')] = kSpace;
+        values[static_cast<uint8_t>('\r')] = kSpace;
+        values[static_cast<uint8_t>('\n')] = kSpace;
+        values[static_cast<uint8_t>('=')] = kPad;
+    }
+};
+
+constexpr DecodeTable kDecode;
+
+[[noreturn]] void fail(const char* what, size_t offset) {
+    throw A2AException(
+        std::string("Base64 decoding error: ") + what + " at offset " + std::to_string(offset),
+        ErrorCode::ParseError
+    );
+}
+
+// Vector kernels consume whole blocks from the front of the input and
+// leave the tail (and anything they cannot handle) to the scalar code.
+// An encode kernel returns the number of input bytes consumed, always a
+// multiple of three; a decode kernel advances both positions and stops at
+// the first block containing anything but base64 characters.
+using EncodeKernel = size_t (*)(const uint8_t* in, size_t size, char* out);
+using DecodeKernel = void (*)(const char* in, size_t size, size_t& pos,
+                              uint8_t* out, size_t& written);
+
+#ifdef A2A_BASE64_X86
+
+// Block algorithms after Wojciech Muła and Daniel Lemire, "Faster Base64
+// Encoding and Decoding Using AVX2 Instructions" (ACM TOW 2018).
+
+__attribute__((target("ssse3")))
+inline __m128i encode_block_ssse3(__m128i in) {
+    // Spread each 3-byte group over a 32-bit lane, then move its four
+    // sextets into separate bytes
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                           4, 5, 3, 4, 1, 2, 0, 1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+    
+    // Map sextets to ASCII by adding a per-range offset: 0..25 -> 13,
+    // 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+}
+
+__attribute__((target("ssse3")))
+size_t encode_ssse3(const uint8_t* in, size_t size, char* out) {
+    // Each block reads 16 bytes but consumes only 12
+    size_t pos = 0;
+    while (size - pos >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), encode_block_ssse3(block));
+        pos += 12;
+        out += 16;
+    }
+    return pos;
+}
+
+__attribute__((target("avx2")))
+size_t encode_avx2(const uint8_t* in, size_t size, char* out) {
+    const __m256i spread = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0);
+    
+    // Each block reads 28 bytes but consumes only 24
+    size_t pos = 0;
+    while (size - pos >= 28) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos + 12));
+        __m256i block = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        
+        block = _mm256_shuffle_epi8(block, spread);
+        const __m256i t0 = _mm256_and_si256(block, _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(block, _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t1, t3);
+        
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        range = _mm256_or_si256(range, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(offsets, range), indices);
+        
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), chars);
+        pos += 24;
+        out += 32;
+    }
+    return pos;
+}
+
+// Decoding classifies each character by its high and low nibble: the
+// two lookups share a set bit exactly when the character is outside the
+// alphabet. The high nibble (or '/') then selects the offset that turns
+// the character into its sextet.
+constexpr char kLowClass[16] = {
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A};
+constexpr char kHighClass[16] = {
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10};
+constexpr char kRoll[16] = {
+    0, 16, 19, 4, -65, -65, -71, -71,
+    0, 0, 0, 0, 0, 0, 0, 0};
+
+__attribute__((target("ssse3")))
+void decode_ssse3(const char* in, size_t size, size_t& pos, uint8_t* out, size_t& written) {
+    const __m128i low_class = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kLowClass));
+    const __m128i high_class = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kHighClass));
+    const __m128i roll = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kRoll));
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i slash = _mm_set1_epi8('/');
+    const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                       -1, -1, -1, -1);
+    
+    // Each block stores 16 bytes but produces only 12; keeping at least
+    // 8 more characters in reserve guarantees room for the spill
+    while (size - pos >= 24) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos));
+        const __m128i high = _mm_and_si128(_mm_srli_epi32(block, 4), nibble);
+        const __m128i low = _mm_and_si128(block, nibble);
+        const __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(low_class, low),
+                                              _mm_shuffle_epi8(high_class, high));
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(invalid, _mm_setzero_si128())) != 0) {
+            return;
+        }
+        
+        const __m128i shift = _mm_add_epi8(_mm_cmpeq_epi8(block, slash), high);
+        block = _mm_add_epi8(block, _mm_shuffle_epi8(roll, shift));
+        
+        // Merge sextet pairs into 12-bit fields, then fields into 24-bit groups
+        block = _mm_maddubs_epi16(block, _mm_set1_epi32(0x01400140));
+        block = _mm_madd_epi16(block, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written),
+                         _mm_shuffle_epi8(block, pack));
+        pos += 16;
+        written += 12;
+    }
+}
+
+__attribute__((target("avx2")))
+void decode_avx2(const char* in, size_t size, size_t& pos, uint8_t* out, size_t& written) {
+    const __m256i low_class = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(kLowClass)));
+    const __m256i high_class = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(kHighClass)));
+    const __m256i roll = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(kRoll)));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i slash = _mm256_set1_epi8('/');
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+    
+    // Each block stores 32 bytes but produces only 24
+    while (size - pos >= 48) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + pos));
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi32(block, 4), nibble);
+        const __m256i low = _mm256_and_si256(block, nibble);
+        const __m256i invalid = _mm256_and_si256(_mm256_shuffle_epi8(low_class, low),
+                                                 _mm256_shuffle_epi8(high_class, high));
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(invalid, _mm256_setzero_si256())) != 0) {
+            return;
+        }
+        
+        const __m256i shift = _mm256_add_epi8(_mm256_cmpeq_epi8(block, slash), high);
+        block = _mm256_add_epi8(block, _mm256_shuffle_epi8(roll, shift));
+        
+        block = _mm256_maddubs_epi16(block, _mm256_set1_epi32(0x01400140));
+        block = _mm256_madd_epi16(block, _mm256_set1_epi32(0x00011000));
+        block = _mm256_shuffle_epi8(block, pack);
+        block = _mm256_permutevar8x32_epi32(block, join);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written), block);
+        pos += 32;
+        written += 24;
+    }
+}
+
+#endif // A2A_BASE64_X86
+
+struct Kernels {
+    EncodeKernel encode = nullptr;
+    DecodeKernel decode = nullptr;
+};
+
+Kernels select_kernels() {
+#ifdef A2A_BASE64_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {encode_avx2, decode_avx2};
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return {encode_ssse3, decode_ssse3};
+    }
+#endif
+    return {};
+}
+
+const Kernels& kernels() {
+    static const Kernels selected = select_kernels();
+    return selected;
+}
+
+void encode_scalar(const uint8_t* in, size_t size, char* out) {
+    size_t pos = 0;
+    for (; size - pos >= 3; pos += 3) {
+        uint32_t group = (uint32_t(in[pos]) << 16) | (uint32_t(in[pos + 1]) << 8) | in[pos + 2];
+        *out++ = kAlphabet[(group >> 18) & 0x3F];
+        *out++ = kAlphabet[(group >> 12) & 0x3F];
+        *out++ = kAlphabet[(group >> 6) & 0x3F];
+        *out++ = kAlphabet[group & 0x3F];
+    }
+    
+    if (pos < size) {
+        uint32_t group = uint32_t(in[pos]) << 16;
+        if (size - pos == 2) {
+            group |= uint32_t(in[pos + 1]) << 8;
+        }
+        *out++ = kAlphabet[(group >> 18) & 0x3F];
+        *out++ = kAlphabet[(group >> 12) & 0x3F];
+        *out++ = size - pos == 2 ? kAlphabet[(group >> 6) & 0x3F] : '=';
+        *out++ = '=';
+    }
+}
+
+/**
+ * Decode the next four significant characters
+ *
+ * Returns false once the input is exhausted, after flushing a final
+ * partial group.
+ */
+bool decode_group(const char* in, size_t size, size_t& pos, uint8_t* out, size_t& written) {
+    uint32_t group = 0;
+    int count = 0;
+    bool padded = false;
+    
+    while (count < 4 && pos < size) {
+        uint8_t value = kDecode.values[static_cast<uint8_t>(in[pos])];
+        if (value < 64) {
+            group = (group << 6) | value;
+            ++count;
+        } else if (value == kPad) {
+            padded = true;
+            break;
+        } else if (value != kSpace) {
+            fail("invalid character", pos);
+        }
+        ++pos;
+    }
+    
+    if (count == 4) {
+        out[written++] = static_cast<uint8_t>(group >> 16);
+        out[written++] = static_cast<uint8_t>(group >> 8);
+        out[written++] = static_cast<uint8_t>(group);
+        return true;
+    }
+    
+    if (count == 1 || (padded && count == 0)) {
+        fail("truncated input", pos);
+    }
+    if (count > 1) {
+        group <<= 6 * (4 - count);
+        out[written++] = static_cast<uint8_t>(group >> 16);
+        if (count == 3) {
+            out[written++] = static_cast<uint8_t>(group >> 8);
+        }
+    }
+    
+    // Only padding and whitespace may follow the final group
+    for (; pos < size; ++pos) {
+        uint8_t value = kDecode.values[static_cast<uint8_t>(in[pos])];
+        if (value != kPad && value != kSpace) {
+            fail("data after padding", pos);
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+void base64_encode(const uint8_t* data, size_t size, char* out) {
+    size_t pos = 0;
+    if (EncodeKernel kernel = kernels().encode) {
+        pos = kernel(data, size, out);
+    }
+    encode_scalar(data + pos, size - pos, out + pos / 3 * 4);
+}
+
+std::string base64_encode(const std::vector<uint8_t>& data) {
+    std::string out(base64_encoded_size(data.size()), '\0');
+    base64_encode(data.data(), data.size(), out.data());
+    return out;
+}
+
+size_t base64_decode(std::string_view text, uint8_t* out) {
+    DecodeKernel kernel = kernels().decode;
+    size_t pos = 0;
+    size_t written = 0;
+    
+    // The kernel hands over at whitespace, padding or the tail; after each
+    // scalar group it gets another chance, so line-wrapped input still
+    // decodes mostly in blocks
+    do {
+        if (kernel) {
+            kernel(text.data(), text.size(), pos, out, written);
+        }
+    } while (decode_group(text.data(), text.size(), pos, out, written));
+    
+    return written;
+}
+
+std::vector<uint8_t> base64_decode(std::string_view text) {
+    std::vector<uint8_t> out(base64_decoded_capacity(text.size()));
+    out.resize(base64_decode(text, out.data()));
+    return out;
+}
+
+} // namespace a2a
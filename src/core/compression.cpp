@@ -0,0 +1,244 @@
+#include <a2a/core/compression.hpp>
+#include <a2a/core/exception.hpp>
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <zlib.h>
+
+namespace a2a {
+
+namespace {
+
+// windowBits for a gzip wrapper rather than a zlib one
+constexpr int GZIP_WINDOW_BITS = 15 + 16;
+
+// Output grows by at least this much when the estimate runs out
+constexpr size_t MIN_OUTPUT_STEP = 16 * 1024;
+
+uInt input_size(std::string_view data) {
+    if (data.size() > UINT_MAX) {
+        throw A2AException("Body too large to compress", ErrorCode::InternalError);
+    }
+    return static_cast<uInt>(data.size());
+}
+
+/**
+ * @brief Inflate state reused by every call on one thread
+ */
+class Inflater {
+public:
+    ~Inflater() {
+        if (initialized_) {
+            inflateEnd(&stream_);
+        }
+    }
+    
+    z_stream& reset() {
+        if (!initialized_) {
+            if (inflateInit2(&stream_, GZIP_WINDOW_BITS) != Z_OK) {
+                throw A2AException("Failed to initialize zlib", ErrorCode::InternalError);
+            }
+            initialized_ = true;
+        } else {
+            inflateReset(&stream_);
+        }
+        return stream_;
+    }
+
+private:
+    z_stream stream_{};
+    bool initialized_ = false;
+};
+
+bool equals_ignore_case(std::string_view a, std::string_view b) {
+    return a.size() == b.size() &&
+           std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+               return std::tolower(static_cast<unsigned char>(x)) ==
+                      std::tolower(static_cast<unsigned char>(y));
+           });
+}
+
+std::string_view trim(std::string_view value) {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+        value.remove_suffix(1);
+    }
+    return value;
+}
+
+// Whether the parameters of an Accept-Encoding entry (";q=0") refuse it
+bool has_zero_quality(std::string_view params) {
+    while (!params.empty()) {
+        size_t semicolon = params.find(';');
+        std::string_view param = trim(params.substr(0, semicolon));
+        params = semicolon == std::string_view::npos ? std::string_view() : params.substr(semicolon + 1);
+        
+        if (param.size() >= 2 && (param[0] == 'q' || param[0] == 'Q') && param[1] == '=') {
+            std::string_view value = param.substr(2);
+            // q=0, q=0.0, q=0.000 all refuse
+            return !value.empty() && value.find_first_not_of("0.") == std::string_view::npos;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+class GzipCompressor::Impl {
+public:
+    ~Impl() {
+        if (initialized_) {
+            deflateEnd(&stream_);
+        }
+    }
+    
+    void reset(int level) {
+        level = std::clamp(level, 1, 9);
+        if (!initialized_) {
+            if (deflateInit2(&stream_, level, Z_DEFLATED, GZIP_WINDOW_BITS, 8,
+                             Z_DEFAULT_STRATEGY) != Z_OK) {
+                throw A2AException("Failed to initialize zlib", ErrorCode::InternalError);
+            }
+            initialized_ = true;
+        } else {
+            deflateReset(&stream_);
+            if (level != level_) {
+                deflateParams(&stream_, level, Z_DEFAULT_STRATEGY);
+            }
+        }
+        level_ = level;
+    }
+    
+    void run(std::string_view data, int flush, std::string& out) {
+        if (!initialized_) {
+            reset(DEFAULT_COMPRESSION_LEVEL);
+        }
+        
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        stream_.avail_in = input_size(data);
+        
+        // Sized from deflateBound so one pass usually suffices
+        for (;;) {
+            size_t start = out.size();
+            size_t room = std::max<size_t>(deflateBound(&stream_, stream_.avail_in) + 16,
+                                           MIN_OUTPUT_STEP);
+            out.resize(start + room);
+            stream_.next_out = reinterpret_cast<Bytef*>(&out[start]);
+            stream_.avail_out = static_cast<uInt>(room);
+            
+            int rc = deflate(&stream_, flush);
+            out.resize(start + room - stream_.avail_out);
+            
+            if (rc == Z_STREAM_ERROR) {
+                throw A2AException("zlib deflate failed", ErrorCode::InternalError);
+            }
+            if (rc == Z_STREAM_END || (stream_.avail_out != 0 && stream_.avail_in == 0)) {
+                return;
+            }
+        }
+    }
+
+private:
+    z_stream stream_{};
+    bool initialized_ = false;
+    int level_ = 0;
+};
+
+GzipCompressor::GzipCompressor() : impl_(std::make_unique<Impl>()) {}
+
+GzipCompressor::~GzipCompressor() = default;
+
+void GzipCompressor::reset(int level) {
+    impl_->reset(level);
+}
+
+void GzipCompressor::write(std::string_view data, std::string& out) {
+    impl_->run(data, Z_SYNC_FLUSH, out);
+}
+
+void GzipCompressor::finish(std::string& out) {
+    impl_->run(std::string_view(), Z_FINISH, out);
+}
+
+void GzipCompressor::compress(std::string_view data, int level, std::string& out) {
+    impl_->reset(level);
+    impl_->run(data, Z_FINISH, out);
+}
+
+std::string gzip_compress(std::string_view data, int level) {
+    thread_local GzipCompressor compressor;
+    std::string out;
+    compressor.compress(data, level, out);
+    return out;
+}
+
+bool gzip_decompress(std::string_view data, std::string& out, size_t max_size) {
+    thread_local Inflater inflater;
+    z_stream& stream = inflater.reset();
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = input_size(data);
+    
+    size_t start = out.size();
+    size_t produced = 0;
+    for (;;) {
+        // One byte past the limit tells "exactly max_size" from "more"
+        size_t room = std::min(std::max(data.size() * 4, MIN_OUTPUT_STEP),
+                               max_size + 1 - produced);
+        room = std::min<size_t>(room, UINT_MAX);
+        out.resize(start + produced + room);
+        stream.next_out = reinterpret_cast<Bytef*>(&out[start + produced]);
+        stream.avail_out = static_cast<uInt>(room);
+        
+        int rc = inflate(&stream, Z_NO_FLUSH);
+        produced += room - stream.avail_out;
+        out.resize(start + produced);
+        
+        if (produced > max_size) {
+            return false;
+        }
+        if (rc == Z_STREAM_END) {
+            if (stream.avail_in == 0) {
+                return true;
+            }
+            // Concatenated members decode as one body
+            inflateReset(&stream);
+            continue;
+        }
+        if (rc != Z_OK) {
+            throw A2AException(rc == Z_BUF_ERROR ? "Truncated gzip body" : "Malformed gzip body",
+                               ErrorCode::ParseError);
+        }
+    }
+}
+
+bool accepts_gzip(std::string_view accept_encoding) {
+    bool gzip_listed = false;
+    bool gzip_refused = false;
+    bool wildcard = false;
+    
+    while (!accept_encoding.empty()) {
+        size_t comma = accept_encoding.find(',');
+        std::string_view entry = accept_encoding.substr(0, comma);
+        accept_encoding = comma == std::string_view::npos ? std::string_view()
+                                                          : accept_encoding.substr(comma + 1);
+        
+        size_t semicolon = entry.find(';');
+        std::string_view coding = trim(entry.substr(0, semicolon));
+        std::string_view params = semicolon == std::string_view::npos ? std::string_view()
+                                                                      : entry.substr(semicolon + 1);
+        bool refused = has_zero_quality(params);
+        
+        if (equals_ignore_case(coding, "gzip") || equals_ignore_case(coding, "x-gzip")) {
+            gzip_listed = true;
+            gzip_refused = refused;
+        } else if (coding == "*") {
+            wildcard = !refused;
+        }
+    }
+    
+    return gzip_listed ? !gzip_refused : wildcard;
+}
+
+} // namespace a2a
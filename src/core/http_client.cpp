@@ -1,8 +1,13 @@
 #include <a2a/core/http_client.hpp>
 #include <a2a/core/exception.hpp>
 #include <curl/curl.h>
-#include <sstream>
-#include <cstring>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace a2a {
 
@@ -14,31 +19,399 @@ static size_t write_callback(void* contents, size_t size, size_t nmemb, void* us
     return total_size;
 }
 
-// Callback for streaming data
+// Streaming transfer state; exceptions must not unwind through libcurl
+struct StreamContext {
+    const HttpClient::ChunkCallback* callback;
+    std::exception_ptr error;
+};
+
+// Callback for streaming data: hands curl's buffer over without copying
 static size_t stream_callback(void* contents, size_t size, size_t nmemb, void* userp) {
     size_t total_size = size * nmemb;
-    auto callback = static_cast<std::function<void(const std::string&)>*>(userp);
-    std::string chunk(static_cast<char*>(contents), total_size);
-    (*callback)(chunk);
+    auto context = static_cast<StreamContext*>(userp);
+    try {
+        (*context->callback)(std::string_view(static_cast<char*>(contents), total_size));
+    } catch (...) {
+        // Returning short aborts the transfer; post_stream rethrows
+        context->error = std::current_exception();
+        return 0;
+    }
     return total_size;
 }
 
+// libcurl global state is initialized once per process, not per client
+static void ensure_curl_global_init() {
+    struct CurlGlobal {
+        CurlGlobal() { curl_global_init(CURL_GLOBAL_DEFAULT); }
+        ~CurlGlobal() { curl_global_cleanup(); }
+    };
+    static CurlGlobal global;
+}
+
+// Status code, Content-Type and caching headers of a finished transfer
+static void read_response_info(CURL* curl, HttpResponse& response) {
+    long status_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status_code);
+    response.status_code = static_cast<int>(status_code);
+    
+    char* content_type = nullptr;
+    if (curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &content_type) == CURLE_OK && content_type) {
+        response.headers["content-type"] = content_type;
+    }
+    
+#if LIBCURL_VERSION_NUM >= 0x075300  // curl_easy_header() needs 7.83
+    for (const char* name : {"etag", "cache-control"}) {
+        curl_header* header = nullptr;
+        if (curl_easy_header(curl, name, 0, CURLH_HEADER, -1, &header) == CURLHE_OK) {
+            response.headers[name] = header->value;
+        }
+    }
+#endif
+}
+
+using HeaderList = std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)>;
+
 // PIMPL implementation
 class HttpClient::Impl {
 public:
-    Impl() : timeout_(30L) {
-        curl_global_init(CURL_GLOBAL_DEFAULT);
+    explicit Impl(const HttpClientOptions& options)
+        : timeout_(30L)
+        , options_(options) {
+        ensure_curl_global_init();
+        
+        // Connections, DNS lookups and TLS sessions are shared by every
+        // pooled handle, so reuse does not depend on which handle is picked.
+        share_ = curl_share_init();
+        if (!share_) {
+            throw A2AException("Failed to initialize CURL share", ErrorCode::InternalError);
+        }
+        curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, share_lock);
+        curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, share_unlock);
+        curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
     }
     
     ~Impl() {
-        curl_global_cleanup();
+        stop_loop();
+        for (auto& idle : idle_handles_) {
+            curl_easy_cleanup(idle.handle);
+        }
+        curl_share_cleanup(share_);
+    }
+    
+    /**
+     * @brief Take a handle from the pool (or create one) configured for reuse
+     */
+    CURL* acquire() {
+        CURL* curl = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(pool_mutex_);
+            evict_expired();
+            if (!idle_handles_.empty()) {
+                // Most recently used first: its connection is the warmest
+                curl = idle_handles_.back().handle;
+                idle_handles_.pop_back();
+            }
+        }
+        
+        if (!curl) {
+            curl = curl_easy_init();
+            if (!curl) {
+                throw A2AException("Failed to initialize CURL", ErrorCode::InternalError);
+            }
+        }
+        
+        curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+        curl_easy_setopt(curl, CURLOPT_MAXCONNECTS, options_.max_idle_connections);
+        curl_easy_setopt(curl, CURLOPT_MAXAGE_CONN, options_.idle_timeout_seconds);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeout_);
+        
+        if (options_.accept_compressed) {
+            // Empty string: offer all built-in codings (gzip, deflate, zstd, ...)
+            curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+        }
+        
+        if (options_.keep_alive) {
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPIDLE, options_.keep_alive_idle_seconds);
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, options_.keep_alive_interval_seconds);
+        }
+        
+        return curl;
+    }
+    
+    /**
+     * @brief Return a handle to the pool once its transfer has finished
+     */
+    void release(CURL* curl) {
+        // Drop per-request options; live connections stay in the share
+        curl_easy_reset(curl);
+        
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        idle_handles_.push_back({curl, std::chrono::steady_clock::now()});
+        while (idle_handles_.size() > options_.max_idle_handles) {
+            curl_easy_cleanup(idle_handles_.front().handle);
+            idle_handles_.pop_front();
+        }
+    }
+    
+    /**
+     * @brief Whether a request body of this size is sent gzipped
+     */
+    bool compresses(size_t body_size) const {
+        return options_.request_compression_min_bytes != 0 &&
+               body_size >= options_.request_compression_min_bytes;
+    }
+    
+    std::string compress(const std::string& body) const {
+        return gzip_compress(body, options_.compression_level);
+    }
+    
+    /**
+     * @brief Build the header list for a request
+     */
+    HeaderList build_headers(const std::string* content_type, bool event_stream,
+                             bool gzipped = false,
+                             const std::map<std::string, std::string>* extra = nullptr) const {
+        curl_slist* header_list = nullptr;
+        
+        if (content_type) {
+            header_list = curl_slist_append(header_list, ("Content-Type: " + *content_type).c_str());
+        }
+        if (gzipped) {
+            header_list = curl_slist_append(header_list, "Content-Encoding: gzip");
+        }
+        if (event_stream) {
+            header_list = curl_slist_append(header_list, "Accept: text/event-stream");
+        }
+        
+        for (const auto& [key, value] : headers_) {
+            std::string header = key + ": " + value;
+            header_list = curl_slist_append(header_list, header.c_str());
+        }
+        if (extra) {
+            for (const auto& [key, value] : *extra) {
+                std::string header = key + ": " + value;
+                header_list = curl_slist_append(header_list, header.c_str());
+            }
+        }
+        
+        return HeaderList(header_list, &curl_slist_free_all);
+    }
+    
+    /**
+     * @brief Returns a pooled handle to the pool when the request scope ends
+     */
+    class Lease {
+    public:
+        explicit Lease(Impl& impl) : impl_(impl), curl_(impl.acquire()) {}
+        ~Lease() { impl_.release(curl_); }
+        
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        
+        CURL* get() const { return curl_; }
+    
+    private:
+        Impl& impl_;
+        CURL* curl_;
+    };
+    
+    /**
+     * @brief In-flight async request, owned by the event loop once submitted
+     */
+    struct AsyncTransfer {
+        CURL* curl = nullptr;
+        std::string body;
+        std::string response_body;
+        HeaderList headers{nullptr, &curl_slist_free_all};
+        CompletionCallback on_complete;
+    };
+    
+    /**
+     * @brief Hand a prepared transfer to the event loop (started on first use)
+     */
+    void submit(std::unique_ptr<AsyncTransfer> transfer) {
+        {
+            std::lock_guard<std::mutex> lock(loop_mutex_);
+            if (!loop_thread_.joinable()) {
+                start_loop();
+            }
+            submitted_.push_back(std::move(transfer));
+        }
+        curl_multi_wakeup(multi_);
     }
     
     long timeout_;
     std::map<std::string, std::string> headers_;
+
+private:
+    // Caller holds loop_mutex_
+    void start_loop() {
+        multi_ = curl_multi_init();
+        if (!multi_) {
+            throw A2AException("Failed to initialize CURL multi", ErrorCode::InternalError);
+        }
+        // Streams to the same origin share one HTTP/2 connection when possible
+        curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(multi_, CURLMOPT_MAXCONNECTS, options_.max_idle_connections);
+        if (options_.max_host_connections > 0) {
+            curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, options_.max_host_connections);
+        }
+        loop_thread_ = std::thread([this] { run_loop(); });
+    }
+    
+    void stop_loop() {
+        {
+            std::lock_guard<std::mutex> lock(loop_mutex_);
+            if (!loop_thread_.joinable()) {
+                return;
+            }
+            stopping_ = true;
+        }
+        curl_multi_wakeup(multi_);
+        loop_thread_.join();
+        curl_multi_cleanup(multi_);
+    }
+    
+    void run_loop() {
+        std::unordered_map<CURL*, std::unique_ptr<AsyncTransfer>> active;
+        std::vector<std::unique_ptr<AsyncTransfer>> incoming;
+        
+        for (;;) {
+            bool stopping;
+            {
+                std::lock_guard<std::mutex> lock(loop_mutex_);
+                incoming.swap(submitted_);
+                stopping = stopping_;
+            }
+            
+            if (stopping) {
+                for (auto& [curl, transfer] : active) {
+                    curl_multi_remove_handle(multi_, curl);
+                    incoming.push_back(std::move(transfer));
+                }
+                for (auto& transfer : incoming) {
+                    fail(std::move(transfer), "HTTP client destroyed with request in flight");
+                }
+                return;
+            }
+            
+            for (auto& transfer : incoming) {
+                CURL* curl = transfer->curl;
+                CURLMcode rc = curl_multi_add_handle(multi_, curl);
+                if (rc != CURLM_OK) {
+                    fail(std::move(transfer), curl_multi_strerror(rc));
+                } else {
+                    active.emplace(curl, std::move(transfer));
+                }
+            }
+            incoming.clear();
+            
+            int running = 0;
+            curl_multi_perform(multi_, &running);
+            
+            CURLMsg* msg;
+            int queued;
+            while ((msg = curl_multi_info_read(multi_, &queued))) {
+                if (msg->msg != CURLMSG_DONE) {
+                    continue;
+                }
+                // msg is invalidated by curl_multi_remove_handle
+                CURL* curl = msg->easy_handle;
+                CURLcode result = msg->data.result;
+                
+                auto it = active.find(curl);
+                if (it == active.end()) {
+                    continue;
+                }
+                std::unique_ptr<AsyncTransfer> transfer = std::move(it->second);
+                active.erase(it);
+                curl_multi_remove_handle(multi_, curl);
+                complete(std::move(transfer), result);
+            }
+            
+            // Sleeps until socket activity, a curl timer, or curl_multi_wakeup
+            curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+        }
+    }
+    
+    void complete(std::unique_ptr<AsyncTransfer> transfer, CURLcode result) {
+        if (result != CURLE_OK) {
+            fail(std::move(transfer), curl_easy_strerror(result));
+            return;
+        }
+        
+        HttpResponse response;
+        read_response_info(transfer->curl, response);
+        response.body = std::move(transfer->response_body);
+        
+        release(transfer->curl);
+        invoke(transfer->on_complete, std::move(response), nullptr);
+    }
+    
+    void fail(std::unique_ptr<AsyncTransfer> transfer, const char* reason) {
+        release(transfer->curl);
+        invoke(transfer->on_complete, HttpResponse(),
+               std::make_exception_ptr(A2AException(
+                   std::string("CURL error: ") + reason,
+                   ErrorCode::InternalError
+               )));
+    }
+    
+    // A throwing callback must not take down the event loop
+    static void invoke(CompletionCallback& on_complete, HttpResponse response,
+                       std::exception_ptr error) {
+        try {
+            on_complete(std::move(response), error);
+        } catch (...) {
+        }
+    }
+
+    struct IdleHandle {
+        CURL* handle;
+        std::chrono::steady_clock::time_point last_used;
+    };
+    
+    // Close handles that have been idle longer than the idle timeout
+    // (oldest are at the front). Caller holds pool_mutex_.
+    void evict_expired() {
+        auto cutoff = std::chrono::steady_clock::now() -
+                      std::chrono::seconds(options_.idle_timeout_seconds);
+        while (!idle_handles_.empty() && idle_handles_.front().last_used < cutoff) {
+            curl_easy_cleanup(idle_handles_.front().handle);
+            idle_handles_.pop_front();
+        }
+    }
+    
+    static void share_lock(CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+        static_cast<Impl*>(userptr)->share_locks_[data].lock();
+    }
+    
+    static void share_unlock(CURL*, curl_lock_data data, void* userptr) {
+        static_cast<Impl*>(userptr)->share_locks_[data].unlock();
+    }
+    
+    HttpClientOptions options_;
+    CURLSH* share_ = nullptr;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> share_locks_;
+    std::mutex pool_mutex_;
+    std::deque<IdleHandle> idle_handles_;
+    
+    CURLM* multi_ = nullptr;
+    std::thread loop_thread_;
+    std::mutex loop_mutex_;
+    std::vector<std::unique_ptr<AsyncTransfer>> submitted_;
+    bool stopping_ = false;
 };
 
-HttpClient::HttpClient() : impl_(std::make_unique<Impl>()) {}
+HttpClient::HttpClient() : HttpClient(HttpClientOptions()) {}
+
+HttpClient::HttpClient(const HttpClientOptions& options)
+    : impl_(std::make_unique<Impl>(options)) {}
 
 HttpClient::~HttpClient() = default;
 
@@ -46,10 +419,13 @@ HttpClient::HttpClient(HttpClient&&) noexcept = default;
 HttpClient& HttpClient::operator=(HttpClient&&) noexcept = default;
 
 HttpResponse HttpClient::get(const std::string& url) {
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw A2AException("Failed to initialize CURL", ErrorCode::InternalError);
-    }
+    return get(url, {});
+}
+
+HttpResponse HttpClient::get(const std::string& url,
+                             const std::map<std::string, std::string>& headers) {
+    Impl::Lease lease(*impl_);
+    CURL* curl = lease.get();
     
     std::string response_body;
     HttpResponse response;
@@ -57,38 +433,25 @@ HttpResponse HttpClient::get(const std::string& url) {
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_body);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, impl_->timeout_);
     curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
     
     // Add custom headers
-    struct curl_slist* header_list = nullptr;
-    for (const auto& [key, value] : impl_->headers_) {
-        std::string header = key + ": " + value;
-        header_list = curl_slist_append(header_list, header.c_str());
-    }
+    HeaderList header_list = impl_->build_headers(nullptr, false, false, &headers);
     if (header_list) {
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list);
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list.get());
     }
     
     CURLcode res = curl_easy_perform(curl);
     
     if (res != CURLE_OK) {
-        curl_slist_free_all(header_list);
-        curl_easy_cleanup(curl);
         throw A2AException(
             std::string("CURL error: ") + curl_easy_strerror(res),
             ErrorCode::InternalError
         );
     }
     
-    long status_code;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status_code);
-    
-    response.status_code = static_cast<int>(status_code);
-    response.body = response_body;
-    
-    curl_slist_free_all(header_list);
-    curl_easy_cleanup(curl);
+    read_response_info(curl, response);
+    response.body = std::move(response_body);
     
     return response;
 }
@@ -96,52 +459,38 @@ HttpResponse HttpClient::get(const std::string& url) {
 HttpResponse HttpClient::post(const std::string& url,
                               const std::string& body,
                               const std::string& content_type) {
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw A2AException("Failed to initialize CURL", ErrorCode::InternalError);
-    }
+    Impl::Lease lease(*impl_);
+    CURL* curl = lease.get();
     
     std::string response_body;
     HttpResponse response;
     
+    bool gzipped = impl_->compresses(body.size());
+    std::string compressed = gzipped ? impl_->compress(body) : std::string();
+    const std::string& payload = gzipped ? compressed : body;
+    
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_POST, 1L);
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.c_str());
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, body.length());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, payload.c_str());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(payload.length()));
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_body);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, impl_->timeout_);
     
     // Set headers
-    struct curl_slist* header_list = nullptr;
-    header_list = curl_slist_append(header_list, ("Content-Type: " + content_type).c_str());
-    
-    for (const auto& [key, value] : impl_->headers_) {
-        std::string header = key + ": " + value;
-        header_list = curl_slist_append(header_list, header.c_str());
-    }
-    
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list);
+    HeaderList header_list = impl_->build_headers(&content_type, false, gzipped);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list.get());
     
     CURLcode res = curl_easy_perform(curl);
     
     if (res != CURLE_OK) {
-        curl_slist_free_all(header_list);
-        curl_easy_cleanup(curl);
         throw A2AException(
             std::string("CURL error: ") + curl_easy_strerror(res),
             ErrorCode::InternalError
         );
     }
     
-    long status_code;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status_code);
-    
-    response.status_code = static_cast<int>(status_code);
-    response.body = response_body;
-    
-    curl_slist_free_all(header_list);
-    curl_easy_cleanup(curl);
+    read_response_info(curl, response);
+    response.body = std::move(response_body);
     
     return response;
 }
@@ -150,35 +499,43 @@ void HttpClient::post_stream(const std::string& url,
                              const std::string& body,
                              const std::string& content_type,
                              std::function<void(const std::string&)> callback) {
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw A2AException("Failed to initialize CURL", ErrorCode::InternalError);
-    }
+    // One buffer serves every chunk; its capacity is kept between chunks
+    std::string chunk;
+    post_stream_chunks(url, body, content_type, [&chunk, &callback](std::string_view data) {
+        chunk.assign(data.data(), data.size());
+        callback(chunk);
+    });
+}
+
+void HttpClient::post_stream_chunks(const std::string& url,
+                                    const std::string& body,
+                                    const std::string& content_type,
+                                    const ChunkCallback& callback) {
+    Impl::Lease lease(*impl_);
+    CURL* curl = lease.get();
+    
+    StreamContext context{&callback, nullptr};
+    
+    bool gzipped = impl_->compresses(body.size());
+    std::string compressed = gzipped ? impl_->compress(body) : std::string();
+    const std::string& payload = gzipped ? compressed : body;
     
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_POST, 1L);
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.c_str());
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, body.length());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, payload.c_str());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(payload.length()));
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, stream_callback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &callback);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, impl_->timeout_);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &context);
     
     // Set headers
-    struct curl_slist* header_list = nullptr;
-    header_list = curl_slist_append(header_list, ("Content-Type: " + content_type).c_str());
-    header_list = curl_slist_append(header_list, "Accept: text/event-stream");
-    
-    for (const auto& [key, value] : impl_->headers_) {
-        std::string header = key + ": " + value;
-        header_list = curl_slist_append(header_list, header.c_str());
-    }
-    
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list);
+    HeaderList header_list = impl_->build_headers(&content_type, true, gzipped);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list.get());
     
     CURLcode res = curl_easy_perform(curl);
     
-    curl_slist_free_all(header_list);
-    curl_easy_cleanup(curl);
+    if (context.error) {
+        std::rethrow_exception(context.error);
+    }
     
     if (res != CURLE_OK) {
         throw A2AException(
@@ -188,6 +545,59 @@ void HttpClient::post_stream(const std::string& url,
     }
 }
 
+std::future<HttpResponse> HttpClient::post_async(const std::string& url,
+                                                 std::string body,
+                                                 const std::string& content_type) {
+    auto promise = std::make_shared<std::promise<HttpResponse>>();
+    std::future<HttpResponse> future = promise->get_future();
+    
+    post_async(url, std::move(body), content_type,
+               [promise](HttpResponse response, std::exception_ptr error) {
+                   if (error) {
+                       promise->set_exception(error);
+                   } else {
+                       promise->set_value(std::move(response));
+                   }
+               });
+    
+    return future;
+}
+
+void HttpClient::post_async(const std::string& url,
+                            std::string body,
+                            const std::string& content_type,
+                            CompletionCallback on_complete) {
+    // Everything that may throw comes before the handle leaves the pool
+    auto transfer = std::make_unique<Impl::AsyncTransfer>();
+    bool gzipped = impl_->compresses(body.size());
+    transfer->body = gzipped ? impl_->compress(body) : std::move(body);
+    transfer->on_complete = std::move(on_complete);
+    transfer->headers = impl_->build_headers(&content_type, false, gzipped);
+    
+    CURL* curl = impl_->acquire();
+    transfer->curl = curl;
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, transfer->body.c_str());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(transfer->body.length()));
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer->response_body);
+    
+    // Negotiate HTTP/2 over TLS and wait for an existing connection to
+    // offer a free stream rather than opening a new one
+    curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+    curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+    
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transfer->headers.get());
+    
+    try {
+        impl_->submit(std::move(transfer));
+    } catch (...) {
+        impl_->release(curl);
+        throw;
+    }
+}
+
 void HttpClient::set_timeout(long seconds) {
     impl_->timeout_ = seconds;
 }
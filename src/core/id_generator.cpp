@@ -0,0 +1,97 @@
+#include <a2a/core/id_generator.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+
+namespace a2a {
+
+namespace {
+
+// Layout after the 48-bit timestamp and 4-bit version:
+//   12 bits  high part of the sequence number   (rand_a)
+//    2 bits  variant 0b10
+//   28 bits  low part of the sequence number    (rand_b, upper)
+//   34 bits  random                             (rand_b, lower)
+// A 40-bit sequence lasts for 10^12 ids before it wraps, and even then a
+// repeat needs the same millisecond.
+constexpr unsigned SEQUENCE_BITS = 40;
+constexpr uint64_t SEQUENCE_MASK = (uint64_t(1) << SEQUENCE_BITS) - 1;
+constexpr unsigned RANDOM_BITS = 34;
+
+// Sequence numbers a thread takes from the shared counter at a time
+constexpr uint64_t BLOCK_SIZE = 4096;
+
+std::atomic<uint64_t> next_block{0};
+
+uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+struct ThreadState {
+    uint64_t sequence = 0;
+    uint64_t sequence_end = 0;
+    uint64_t last_millis = 0;
+    uint64_t random_state;
+    
+    ThreadState() {
+        std::random_device device;
+        random_state = (uint64_t(device()) << 32) ^ device() ^
+                       std::hash<std::thread::id>()(std::this_thread::get_id());
+    }
+};
+
+} // namespace
+
+Uuid generate_uuid_v7() {
+    thread_local ThreadState state;
+    
+    if (state.sequence == state.sequence_end) {
+        state.sequence = next_block.fetch_add(BLOCK_SIZE, std::memory_order_relaxed);
+        state.sequence_end = state.sequence + BLOCK_SIZE;
+    }
+    uint64_t sequence = state.sequence++ & SEQUENCE_MASK;
+    
+    // Never step back within a thread, even if the wall clock does
+    uint64_t millis = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    millis = std::max(millis, state.last_millis);
+    state.last_millis = millis;
+    
+    uint64_t random = splitmix64(state.random_state) & ((uint64_t(1) << RANDOM_BITS) - 1);
+    
+    uint64_t high = (millis << 16) | (uint64_t(0x7) << 12) | (sequence >> 28);
+    uint64_t low = (uint64_t(0x2) << 62) | ((sequence & 0xFFFFFFF) << RANDOM_BITS) | random;
+    
+    Uuid uuid;
+    for (int i = 0; i < 8; ++i) {
+        uuid[i] = static_cast<uint8_t>(high >> (56 - 8 * i));
+        uuid[8 + i] = static_cast<uint8_t>(low >> (56 - 8 * i));
+    }
+    return uuid;
+}
+
+void format_uuid(const Uuid& uuid, char* out) {
+    static const char* hex = "0123456789abcdef";
+    
+    for (size_t i = 0; i < uuid.size(); ++i) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+            *out++ = '-';
+        }
+        *out++ = hex[uuid[i] >> 4];
+        *out++ = hex[uuid[i] & 0x0f];
+    }
+}
+
+std::string generate_id() {
+    std::string id(UUID_TEXT_LENGTH, '\0');
+    format_uuid(generate_uuid_v7(), id.data());
+    return id;
+}
+
+} // namespace a2a
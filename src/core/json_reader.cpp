@@ -0,0 +1,868 @@
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/exception.hpp>
+#include <a2a/core/json_writer.hpp>
+#include <a2a/core/base64.hpp>
+#include "json_scan.hpp"
+#include "transcode.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace a2a {
+
+namespace {
+
+int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+void append_utf8(std::string& out, uint32_t cp) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+constexpr uint64_t CBOR_INDEFINITE = UINT64_MAX;
+constexpr uint8_t CBOR_BREAK = 0xFF;
+
+// Nesting limit for skipping either format, so hostile input cannot
+// exhaust the stack
+constexpr size_t MAX_DEPTH = 512;
+
+// IEEE 754 half precision (RFC 8949 Appendix D)
+double decode_half(uint16_t half) {
+    int exponent = (half >> 10) & 0x1F;
+    int mantissa = half & 0x3FF;
+    double value;
+    if (exponent == 0) {
+        value = std::ldexp(mantissa, -24);
+    } else if (exponent != 31) {
+        value = std::ldexp(mantissa + 1024, exponent - 25);
+    } else {
+        value = mantissa == 0 ? HUGE_VAL : std::nan("");
+    }
+    return (half & 0x8000) ? -value : value;
+}
+
+} // namespace
+
+void JsonReader::fail(const char* what) const {
+    throw A2AException(
+        std::string("JSON parsing error: ") + what + " at offset " + std::to_string(pos_),
+        ErrorCode::ParseError
+    );
+}
+
+void JsonReader::fail_not_string(std::string_view name) const {
+    // Well-formed input of the wrong shape: the caller's parameters are at fault
+    throw A2AException(
+        "Value of \"" + std::string(name) + "\" must be a string at offset " + std::to_string(pos_),
+        ErrorCode::InvalidParams
+    );
+}
+
+void JsonReader::skip_whitespace() {
+    while (pos_ < in_.size()) {
+        char c = in_[pos_];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            break;
+        }
+        ++pos_;
+    }
+}
+
+void JsonReader::expect(char c) {
+    skip_whitespace();
+    if (pos_ >= in_.size() || in_[pos_] != c) {
+        char what[] = "expected ' '";
+        what[10] = c;
+        fail(what);
+    }
+    ++pos_;
+}
+
+void JsonReader::expect_literal(std::string_view literal) {
+    if (in_.compare(pos_, literal.size(), literal) != 0) {
+        fail("invalid literal");
+    }
+    pos_ += literal.size();
+}
+
+JsonReader::Type JsonReader::peek() {
+    if (cbor_) {
+        return cbor_peek();
+    }
+    
+    skip_whitespace();
+    if (pos_ >= in_.size()) {
+        fail("unexpected end of input");
+    }
+    
+    switch (in_[pos_]) {
+        case 'n': return Type::Null;
+        case 't':
+        case 'f': return Type::Boolean;
+        case '"': return Type::String;
+        case '{': return Type::Object;
+        case '[': return Type::Array;
+        default:
+            if (in_[pos_] == '-' || (in_[pos_] >= '0' && in_[pos_] <= '9')) {
+                return Type::Number;
+            }
+            fail("unexpected character");
+    }
+}
+
+void JsonReader::begin_object() {
+    if (cbor_) {
+        cbor_begin(5);
+        return;
+    }
+    
+    expect('{');
+    first_ = true;
+}
+
+bool JsonReader::next_key(std::string_view& key) {
+    if (cbor_) {
+        if (!cbor_next()) {
+            return false;
+        }
+        key = cbor_read_string(3);
+        return true;
+    }
+    
+    skip_whitespace();
+    if (pos_ < in_.size() && in_[pos_] == '}') {
+        ++pos_;
+        first_ = false;
+        return false;
+    }
+    
+    if (!first_) {
+        expect(',');
+        skip_whitespace();
+    }
+    first_ = false;
+    
+    if (pos_ >= in_.size() || in_[pos_] != '"') {
+        fail("expected object key");
+    }
+    
+    bool has_escapes = false;
+    std::string_view raw = scan_string(has_escapes);
+    if (has_escapes) {
+        scratch_.clear();
+        decode_string(raw, scratch_);
+        key = scratch_;
+    } else {
+        key = raw;
+    }
+    
+    expect(':');
+    return true;
+}
+
+void JsonReader::begin_array() {
+    if (cbor_) {
+        cbor_begin(4);
+        return;
+    }
+    
+    expect('[');
+    first_ = true;
+}
+
+bool JsonReader::next_element() {
+    if (cbor_) {
+        return cbor_next();
+    }
+    
+    skip_whitespace();
+    if (pos_ < in_.size() && in_[pos_] == ']') {
+        ++pos_;
+        first_ = false;
+        return false;
+    }
+    
+    if (!first_) {
+        expect(',');
+    }
+    first_ = false;
+    return true;
+}
+
+std::string_view JsonReader::scan_string(bool& has_escapes) {
+    // pos_ is on the opening quote
+    size_t start = ++pos_;
+    has_escapes = false;
+    
+    while (pos_ < in_.size()) {
+        pos_ += find_json_special(in_.data() + pos_, in_.size() - pos_);
+        if (pos_ == in_.size()) {
+            break;
+        }
+        
+        unsigned char c = static_cast<unsigned char>(in_[pos_]);
+        if (c == '"') {
+            std::string_view raw = in_.substr(start, pos_ - start);
+            ++pos_;
+            return raw;
+        }
+        if (c == '\\') {
+            // Checked here as well as in decode_string so that skipped
+            // strings are validated too
+            has_escapes = true;
+            if (pos_ + 1 >= in_.size()) {
+                break;
+            }
+            switch (in_[pos_ + 1]) {
+                case '"': case '\\': case '/': case 'b':
+                case 'f': case 'n': case 'r': case 't':
+                    pos_ += 2;
+                    continue;
+                case 'u':
+                    if (pos_ + 6 > in_.size()) {
+                        break;
+                    }
+                    for (size_t i = 2; i < 6; ++i) {
+                        if (hex_value(in_[pos_ + i]) < 0) {
+                            fail("invalid unicode escape");
+                        }
+                    }
+                    pos_ += 6;
+                    continue;
+                default:
+                    fail("invalid escape");
+            }
+            break;
+        }
+        fail("control character in string");
+    }
+    
+    fail("unterminated string");
+}
+
+void JsonReader::decode_string(std::string_view raw, std::string& out) const {
+    out.reserve(out.size() + raw.size());
+    
+    size_t i = 0;
+    while (i < raw.size()) {
+        size_t run = raw.find('\\', i);
+        if (run == std::string_view::npos) {
+            out.append(raw.data() + i, raw.size() - i);
+            break;
+        }
+        out.append(raw.data() + i, run - i);
+        i = run + 1;
+        if (i >= raw.size()) {
+            fail("invalid escape");
+        }
+        
+        char esc = raw[i++];
+        switch (esc) {
+            case '"':  out.push_back('"'); break;
+            case '\\': out.push_back('\\'); break;
+            case '/':  out.push_back('/'); break;
+            case 'b':  out.push_back('\b'); break;
+            case 'f':  out.push_back('\f'); break;
+            case 'n':  out.push_back('\n'); break;
+            case 'r':  out.push_back('\r'); break;
+            case 't':  out.push_back('\t'); break;
+            case 'u': {
+                auto read_hex4 = [&](size_t at) -> int32_t {
+                    if (at + 4 > raw.size()) return -1;
+                    int32_t v = 0;
+                    for (size_t k = 0; k < 4; ++k) {
+                        int h = hex_value(raw[at + k]);
+                        if (h < 0) return -1;
+                        v = (v << 4) | h;
+                    }
+                    return v;
+                };
+                
+                int32_t cp = read_hex4(i);
+                if (cp < 0) {
+                    fail("invalid unicode escape");
+                }
+                i += 4;
+                
+                if (cp >= 0xD800 && cp <= 0xDBFF) {
+                    // High surrogate: combine with a following low surrogate
+                    int32_t low = -1;
+                    if (i + 1 < raw.size() && raw[i] == '\\' && raw[i + 1] == 'u') {
+                        low = read_hex4(i + 2);
+                    }
+                    if (low >= 0xDC00 && low <= 0xDFFF) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    } else {
+                        cp = 0xFFFD;
+                    }
+                } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                    cp = 0xFFFD;
+                }
+                
+                append_utf8(out, static_cast<uint32_t>(cp));
+                break;
+            }
+            default:
+                fail("invalid escape");
+        }
+    }
+}
+
+std::string JsonReader::read_string() {
+    if (cbor_) {
+        return std::string(cbor_read_string(3));
+    }
+    
+    skip_whitespace();
+    if (pos_ >= in_.size() || in_[pos_] != '"') {
+        fail("expected string");
+    }
+    
+    bool has_escapes = false;
+    std::string_view raw = scan_string(has_escapes);
+    first_ = false;
+    
+    if (!has_escapes) {
+        return std::string(raw);
+    }
+    
+    std::string out;
+    decode_string(raw, out);
+    return out;
+}
+
+std::string_view JsonReader::read_string_view() {
+    if (cbor_) {
+        return cbor_read_string(3);
+    }
+    
+    skip_whitespace();
+    if (pos_ >= in_.size() || in_[pos_] != '"') {
+        fail("expected string");
+    }
+    
+    bool has_escapes = false;
+    std::string_view raw = scan_string(has_escapes);
+    first_ = false;
+    
+    if (!has_escapes) {
+        return raw;
+    }
+    
+    scratch_.clear();
+    decode_string(raw, scratch_);
+    return scratch_;
+}
+
+void JsonReader::skip_number() {
+    size_t start = pos_;
+    while (pos_ < in_.size()) {
+        char c = in_[pos_];
+        if ((c >= '0' && c <= '9') || c == '-' || c == '+' ||
+            c == '.' || c == 'e' || c == 'E') {
+            ++pos_;
+        } else {
+            break;
+        }
+    }
+    if (pos_ == start) {
+        fail("unexpected character");
+    }
+}
+
+int64_t JsonReader::read_int() {
+    if (cbor_) {
+        return cbor_read_int();
+    }
+    
+    skip_whitespace();
+    
+    int64_t value = 0;
+    const char* begin = in_.data() + pos_;
+    const char* end = in_.data() + in_.size();
+    auto result = std::from_chars(begin, end, value);
+    if (result.ec != std::errc()) {
+        fail("expected integer");
+    }
+    pos_ += static_cast<size_t>(result.ptr - begin);
+    
+    // Tolerate a fractional/exponent tail by truncating it
+    if (pos_ < in_.size() && (in_[pos_] == '.' || in_[pos_] == 'e' || in_[pos_] == 'E')) {
+        skip_number();
+    }
+    
+    first_ = false;
+    return value;
+}
+
+bool JsonReader::read_bool() {
+    if (cbor_) {
+        cbor_skip_tags();
+        uint8_t initial = cbor_peek_byte();
+        if (initial != 0xF4 && initial != 0xF5) {
+            fail("expected boolean");
+        }
+        ++pos_;
+        return initial == 0xF5;
+    }
+    
+    skip_whitespace();
+    bool value;
+    if (pos_ < in_.size() && in_[pos_] == 't') {
+        expect_literal("true");
+        value = true;
+    } else if (pos_ < in_.size() && in_[pos_] == 'f') {
+        expect_literal("false");
+        value = false;
+    } else {
+        fail("expected boolean");
+    }
+    first_ = false;
+    return value;
+}
+
+bool JsonReader::consume_null() {
+    if (cbor_) {
+        // Undefined is read as null
+        cbor_skip_tags();
+        uint8_t initial = cbor_peek_byte();
+        if (initial == 0xF6 || initial == 0xF7) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+    
+    skip_whitespace();
+    if (pos_ < in_.size() && in_[pos_] == 'n') {
+        expect_literal("null");
+        first_ = false;
+        return true;
+    }
+    return false;
+}
+
+std::string_view JsonReader::read_raw() {
+    if (!cbor_) {
+        skip_whitespace();
+    }
+    size_t start = pos_;
+    skip_value();
+    return in_.substr(start, pos_ - start);
+}
+
+std::string_view JsonReader::read_json_text() {
+    if (!cbor_) {
+        return read_raw();
+    }
+    
+    transcoded_.clear();
+    JsonWriter writer(transcoded_);
+    transcode_value(*this, writer);
+    return transcoded_;
+}
+
+bool JsonReader::peek_integer() {
+    if (cbor_) {
+        if (cbor_peek() != Type::Number) {
+            return false;
+        }
+        // Within int64_t range
+        CborHead head{};
+        size_t start = pos_;
+        uint8_t major = cbor_peek_byte() >> 5;
+        if (major > 1) {
+            return false;
+        }
+        head = cbor_head();
+        pos_ = start;
+        return head.argument <= static_cast<uint64_t>(INT64_MAX);
+    }
+    
+    skip_whitespace();
+    size_t end = pos_;
+    while (end < in_.size()) {
+        char c = in_[end];
+        if (c == '.' || c == 'e' || c == 'E') {
+            return false;
+        }
+        if ((c < '0' || c > '9') && c != '-' && c != '+') {
+            break;
+        }
+        ++end;
+    }
+    
+    int64_t value;
+    auto result = std::from_chars(in_.data() + pos_, in_.data() + end, value);
+    return result.ec == std::errc() && result.ptr == in_.data() + end;
+}
+
+double JsonReader::read_double() {
+    if (cbor_) {
+        return cbor_read_double();
+    }
+    
+    skip_whitespace();
+    size_t start = pos_;
+    skip_number();
+    
+    double value = 0;
+    auto result = std::from_chars(in_.data() + start, in_.data() + pos_, value);
+    if (result.ec != std::errc() || result.ptr != in_.data() + pos_) {
+        pos_ = start;
+        fail("expected number");
+    }
+    first_ = false;
+    return value;
+}
+
+std::vector<uint8_t> JsonReader::read_bytes() {
+    if (cbor_ && cbor_peek() == Type::Bytes) {
+        std::string_view data = cbor_read_string(2);
+        std::vector<uint8_t> bytes(data.size());
+        if (!data.empty()) {
+            std::memcpy(bytes.data(), data.data(), data.size());
+        }
+        return bytes;
+    }
+    return base64_decode(read_string_view());
+}
+
+size_t JsonReader::mark() {
+    if (!cbor_) {
+        skip_whitespace();
+    }
+    return pos_;
+}
+
+void JsonReader::skip_value() {
+    if (cbor_) {
+        cbor_skip_value(0);
+        return;
+    }
+    
+    json_skip_value(0);
+    first_ = false;
+}
+
+void JsonReader::json_skip_value(size_t depth) {
+    if (depth > MAX_DEPTH) {
+        fail("nesting too deep");
+    }
+    
+    skip_whitespace();
+    if (pos_ >= in_.size()) {
+        fail("unexpected end of input");
+    }
+    
+    bool has_escapes = false;
+    switch (in_[pos_]) {
+        case '{':
+            ++pos_;
+            skip_whitespace();
+            if (pos_ < in_.size() && in_[pos_] == '}') {
+                ++pos_;
+                return;
+            }
+            for (;;) {
+                skip_whitespace();
+                if (pos_ >= in_.size() || in_[pos_] != '"') {
+                    fail("expected object key");
+                }
+                scan_string(has_escapes);
+                expect(':');
+                json_skip_value(depth + 1);
+                skip_whitespace();
+                if (pos_ >= in_.size() || in_[pos_] != ',') {
+                    break;
+                }
+                ++pos_;
+            }
+            expect('}');
+            break;
+        case '[':
+            ++pos_;
+            skip_whitespace();
+            if (pos_ < in_.size() && in_[pos_] == ']') {
+                ++pos_;
+                return;
+            }
+            for (;;) {
+                json_skip_value(depth + 1);
+                skip_whitespace();
+                if (pos_ >= in_.size() || in_[pos_] != ',') {
+                    break;
+                }
+                ++pos_;
+            }
+            expect(']');
+            break;
+        case '"':
+            scan_string(has_escapes);
+            break;
+        case 't':
+            expect_literal("true");
+            break;
+        case 'f':
+            expect_literal("false");
+            break;
+        case 'n':
+            expect_literal("null");
+            break;
+        default: {
+            size_t start = pos_;
+            skip_number();
+            double value = 0;
+            auto result = std::from_chars(in_.data() + start, in_.data() + pos_, value);
+            if (result.ec == std::errc::invalid_argument || result.ptr != in_.data() + pos_) {
+                pos_ = start;
+                fail("invalid number");
+            }
+            break;
+        }
+    }
+}
+
+// CBOR
+
+uint8_t JsonReader::cbor_peek_byte() {
+    if (pos_ >= in_.size()) {
+        fail("unexpected end of input");
+    }
+    return static_cast<uint8_t>(in_[pos_]);
+}
+
+JsonReader::CborHead JsonReader::cbor_head() {
+    uint8_t initial = cbor_peek_byte();
+    ++pos_;
+    
+    CborHead head{static_cast<uint8_t>(initial >> 5), 0, false};
+    uint8_t info = initial & 0x1F;
+    if (info < 24) {
+        head.argument = info;
+    } else if (info <= 27) {
+        size_t size = size_t(1) << (info - 24);
+        if (in_.size() - pos_ < size) {
+            fail("unexpected end of input");
+        }
+        for (size_t i = 0; i < size; ++i) {
+            head.argument = (head.argument << 8) | static_cast<uint8_t>(in_[pos_ + i]);
+        }
+        pos_ += size;
+    } else if (info == 31 && head.major >= 2 && head.major <= 5) {
+        head.indefinite = true;
+    } else {
+        --pos_;
+        fail("invalid CBOR item");
+    }
+    return head;
+}
+
+void JsonReader::cbor_skip_tags() {
+    while (cbor_peek_byte() >> 5 == 6) {
+        cbor_head();
+    }
+}
+
+JsonReader::Type JsonReader::cbor_peek() {
+    cbor_skip_tags();
+    uint8_t initial = cbor_peek_byte();
+    switch (initial >> 5) {
+        case 0:
+        case 1: return Type::Number;
+        case 2: return Type::Bytes;
+        case 3: return Type::String;
+        case 4: return Type::Array;
+        case 5: return Type::Object;
+        default:
+            if (initial == 0xF4 || initial == 0xF5) {
+                return Type::Boolean;
+            }
+            if (initial == 0xF6 || initial == 0xF7) {
+                return Type::Null;
+            }
+            if (initial >= 0xF9 && initial <= 0xFB) {
+                return Type::Number;
+            }
+            fail("unsupported CBOR simple value");
+    }
+}
+
+void JsonReader::cbor_begin(uint8_t major) {
+    cbor_skip_tags();
+    CborHead head = cbor_head();
+    if (head.major != major) {
+        fail(major == 5 ? "expected object" : "expected array");
+    }
+    if (containers_.size() >= MAX_DEPTH) {
+        fail("nesting too deep");
+    }
+    // Every item takes at least a byte, which bounds any honest count
+    if (!head.indefinite && head.argument > in_.size() - pos_) {
+        fail("unexpected end of input");
+    }
+    containers_.push_back(head.indefinite ? CBOR_INDEFINITE : head.argument);
+}
+
+bool JsonReader::cbor_next() {
+    if (containers_.empty()) {
+        fail("not inside an object or array");
+    }
+    
+    uint64_t& remaining = containers_.back();
+    if (remaining == CBOR_INDEFINITE) {
+        if (cbor_peek_byte() != CBOR_BREAK) {
+            return true;
+        }
+        ++pos_;
+    } else if (remaining != 0) {
+        --remaining;
+        return true;
+    }
+    containers_.pop_back();
+    return false;
+}
+
+std::string_view JsonReader::cbor_read_string(uint8_t major) {
+    cbor_skip_tags();
+    CborHead head = cbor_head();
+    if (head.major != major) {
+        fail(major == 3 ? "expected string" : "expected byte string");
+    }
+    
+    if (!head.indefinite) {
+        if (head.argument > in_.size() - pos_) {
+            fail("unexpected end of input");
+        }
+        std::string_view value = in_.substr(pos_, static_cast<size_t>(head.argument));
+        pos_ += static_cast<size_t>(head.argument);
+        return value;
+    }
+    
+    // Indefinite length: definite chunks of the same type until a break
+    scratch_.clear();
+    while (cbor_peek_byte() != CBOR_BREAK) {
+        CborHead chunk = cbor_head();
+        if (chunk.major != major || chunk.indefinite || chunk.argument > in_.size() - pos_) {
+            fail("invalid string chunk");
+        }
+        scratch_.append(in_.data() + pos_, static_cast<size_t>(chunk.argument));
+        pos_ += static_cast<size_t>(chunk.argument);
+    }
+    ++pos_;
+    return scratch_;
+}
+
+int64_t JsonReader::cbor_read_int() {
+    cbor_skip_tags();
+    uint8_t major = cbor_peek_byte() >> 5;
+    if (major > 1) {
+        // Tolerate a float by truncating it, as for JSON
+        double value = cbor_read_double();
+        if (!(value >= -9.2e18 && value <= 9.2e18)) {
+            fail("integer out of range");
+        }
+        return static_cast<int64_t>(value);
+    }
+    
+    CborHead head = cbor_head();
+    if (head.argument > static_cast<uint64_t>(INT64_MAX)) {
+        fail("integer out of range");
+    }
+    int64_t value = static_cast<int64_t>(head.argument);
+    return major == 0 ? value : -1 - value;
+}
+
+double JsonReader::cbor_read_double() {
+    cbor_skip_tags();
+    uint8_t initial = cbor_peek_byte();
+    if (initial >> 5 <= 1) {
+        CborHead head = cbor_head();
+        double magnitude = static_cast<double>(head.argument);
+        return head.major == 0 ? magnitude : -1.0 - magnitude;
+    }
+    if (initial < 0xF9 || initial > 0xFB) {
+        fail("expected number");
+    }
+    
+    CborHead head = cbor_head();
+    if (initial == 0xF9) {
+        return decode_half(static_cast<uint16_t>(head.argument));
+    }
+    if (initial == 0xFA) {
+        uint32_t bits = static_cast<uint32_t>(head.argument);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    double value;
+    std::memcpy(&value, &head.argument, sizeof(value));
+    return value;
+}
+
+void JsonReader::cbor_skip_value(size_t depth) {
+    if (depth > MAX_DEPTH) {
+        fail("nesting too deep");
+    }
+    
+    CborHead head = cbor_head();
+    switch (head.major) {
+        case 2:
+        case 3:
+            if (head.indefinite) {
+                --pos_;
+                cbor_read_string(head.major);
+            } else {
+                if (head.argument > in_.size() - pos_) {
+                    fail("unexpected end of input");
+                }
+                pos_ += static_cast<size_t>(head.argument);
+            }
+            break;
+        case 4:
+        case 5:
+            if (head.indefinite) {
+                while (cbor_peek_byte() != CBOR_BREAK) {
+                    cbor_skip_value(depth + 1);
+                }
+                ++pos_;
+            } else {
+                if (head.argument > in_.size() - pos_) {
+                    fail("unexpected end of input");
+                }
+                uint64_t items = head.major == 5 ? head.argument * 2 : head.argument;
+                for (uint64_t i = 0; i < items; ++i) {
+                    cbor_skip_value(depth + 1);
+                }
+            }
+            break;
+        case 6:
+            // A tag applies to the item that follows it
+            cbor_skip_value(depth + 1);
+            break;
+        default:
+            // Integers, simple values and floats are complete after the head
+            break;
+    }
+}
+
+} // namespace a2a
@@ -0,0 +1,312 @@
+#include "json_scan.hpp"
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define A2A_JSON_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace a2a {
+
+namespace {
+
+inline bool is_special(unsigned char c) {
+    return c == '"' || c == '\\' || c < 0x20;
+}
+
+/**
+ * Length of the well-formed sequence at p, or 0 if ill-formed, in which
+ * case skip is the length of its maximal ill-formed prefix (at least 1)
+ */
+size_t utf8_sequence(const unsigned char* p, size_t size, size_t& skip) {
+    unsigned char lead = p[0];
+    if (lead < 0x80) {
+        return 1;
+    }
+    
+    // Second-byte bounds exclude overlong forms, surrogates and values
+    // above U+10FFFF
+    size_t length;
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        if (lead == 0xE0) {
+            lo = 0xA0;
+        } else if (lead == 0xED) {
+            hi = 0x9F;
+        }
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        if (lead == 0xF0) {
+            lo = 0x90;
+        } else if (lead == 0xF4) {
+            hi = 0x8F;
+        }
+    } else {
+        skip = 1;
+        return 0;
+    }
+    
+    for (size_t i = 1; i < length; ++i) {
+        if (i >= size || p[i] < lo || p[i] > hi) {
+            skip = i;
+            return 0;
+        }
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    return length;
+}
+
+bool is_valid_utf8_scalar(const unsigned char* p, size_t size) {
+    size_t pos = 0;
+    while (pos < size) {
+        // Skip ASCII eight bytes at a time
+        if (size - pos >= 8) {
+            uint64_t word;
+            std::memcpy(&word, p + pos, sizeof(word));
+            if ((word & 0x8080808080808080ULL) == 0) {
+                pos += 8;
+                continue;
+            }
+        }
+        
+        size_t skip;
+        size_t length = utf8_sequence(p + pos, size - pos, skip);
+        if (length == 0) {
+            return false;
+        }
+        pos += length;
+    }
+    return true;
+}
+
+#ifdef A2A_JSON_SCAN_X86
+
+bool cpu_has_avx2() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+}
+
+bool cpu_has_ssse3() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+    }();
+    return supported;
+}
+
+// SSE2 is part of x86-64, so the 16-byte scan needs no dispatch
+inline __m128i special_mask_sse2(__m128i block) {
+    const __m128i quote = _mm_cmpeq_epi8(block, _mm_set1_epi8('"'));
+    const __m128i backslash = _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'));
+    // Unsigned block <= 0x1F
+    const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(block, _mm_set1_epi8(0x1F)), block);
+    return _mm_or_si128(_mm_or_si128(quote, backslash), control);
+}
+
+/**
+ * Scan 32-byte blocks; returns the offset of the first special byte or
+ * of the first unscanned byte once fewer than 32 remain
+ */
+__attribute__((target("avx2")))
+size_t find_special_avx2(const char* data, size_t size) {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i control_max = _mm256_set1_epi8(0x1F);
+    
+    size_t pos = 0;
+    for (; size - pos >= 32; pos += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        __m256i special = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash)),
+            _mm256_cmpeq_epi8(_mm256_min_epu8(block, control_max), block));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+    return pos;
+}
+
+// UTF-8 validation after John Keiser and Daniel Lemire, "Validating UTF-8
+// In Less Than One Instruction Per Byte" (SP&E 2021). Three nibble
+// lookups flag the error classes possible for each pair of adjacent
+// bytes; continuation bytes of 3- and 4-byte sequences are checked by
+// position.
+constexpr char kTooShort = 1 << 0;
+constexpr char kTooLong = 1 << 1;
+constexpr char kOverlong3 = 1 << 2;
+constexpr char kTooLarge = 1 << 3;
+constexpr char kSurrogate = 1 << 4;
+constexpr char kOverlong2 = 1 << 5;
+constexpr char kTooLarge1000 = 1 << 6;
+constexpr char kOverlong4 = 1 << 6;
+constexpr char kTwoConts = static_cast<char>(1 << 7);
+constexpr char kCarry = kTooShort | kTooLong | kTwoConts;
+
+struct Utf8State {
+    __m128i previous;
+    __m128i previous_incomplete;
+    __m128i error;
+};
+
+__attribute__((target("ssse3")))
+inline void check_utf8_block(__m128i input, Utf8State& state) {
+    if (_mm_movemask_epi8(input) == 0) {
+        // ASCII only: just make sure the last block did not end mid-sequence
+        state.error = _mm_or_si128(state.error, state.previous_incomplete);
+        state.previous = input;
+        state.previous_incomplete = _mm_setzero_si128();
+        return;
+    }
+    
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i byte_1_high_table = _mm_setr_epi8(
+        kTooLong, kTooLong, kTooLong, kTooLong,
+        kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+        kTooShort | kOverlong2,
+        kTooShort,
+        kTooShort | kOverlong3 | kSurrogate,
+        kTooShort | kTooLarge | kTooLarge1000 | kOverlong4);
+    const __m128i byte_1_low_table = _mm_setr_epi8(
+        kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+        kCarry | kOverlong2,
+        kCarry,
+        kCarry,
+        kCarry | kTooLarge,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000);
+    const __m128i byte_2_high_table = _mm_setr_epi8(
+        kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooShort, kTooShort, kTooShort, kTooShort);
+    
+    const __m128i prev1 = _mm_alignr_epi8(input, state.previous, 15);
+    const __m128i byte_1_high = _mm_shuffle_epi8(
+        byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+    const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble));
+    const __m128i byte_2_high = _mm_shuffle_epi8(
+        byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+    
+    // Bytes two or three past a 3- or 4-byte lead must be continuations,
+    // which the pair lookup reports as kTwoConts; the xor cancels exactly
+    // those and flags any that are missing
+    const __m128i prev2 = _mm_alignr_epi8(input, state.previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, state.previous, 13);
+    const __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    const __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    const __m128i must_continue = _mm_and_si128(_mm_or_si128(third, fourth),
+                                                _mm_set1_epi8(static_cast<char>(0x80)));
+    state.error = _mm_or_si128(state.error, _mm_xor_si128(must_continue, special));
+    
+    // A lead byte in the last three positions needs bytes from the next block
+    const __m128i incomplete_max = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+    state.previous_incomplete = _mm_subs_epu8(input, incomplete_max);
+    state.previous = input;
+}
+
+__attribute__((target("ssse3")))
+bool is_valid_utf8_ssse3(const char* data, size_t size) {
+    Utf8State state{_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+    
+    size_t pos = 0;
+    for (; size - pos >= 16; pos += 16) {
+        check_utf8_block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)), state);
+    }
+    
+    // Zero padding reads as ASCII, so a truncated final sequence shows up
+    // as too short
+    alignas(16) char tail[16] = {};
+    std::memcpy(tail, data + pos, size - pos);
+    check_utf8_block(_mm_load_si128(reinterpret_cast<const __m128i*>(tail)), state);
+    
+    state.error = _mm_or_si128(state.error, state.previous_incomplete);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(state.error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+#endif // A2A_JSON_SCAN_X86
+
+} // namespace
+
+size_t find_json_special(const char* data, size_t size) {
+    size_t pos = 0;
+
+#ifdef A2A_JSON_SCAN_X86
+    if (size >= 32 && cpu_has_avx2()) {
+        pos = find_special_avx2(data, size);
+    }
+    for (; size - pos >= 16; pos += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special_mask_sse2(block)));
+        if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+#endif
+    
+    for (; pos < size; ++pos) {
+        if (is_special(static_cast<unsigned char>(data[pos]))) {
+            break;
+        }
+    }
+    return pos;
+}
+
+bool is_valid_utf8(const char* data, size_t size) {
+#ifdef A2A_JSON_SCAN_X86
+    if (size >= 16 && cpu_has_ssse3()) {
+        return is_valid_utf8_ssse3(data, size);
+    }
+#endif
+    return is_valid_utf8_scalar(reinterpret_cast<const unsigned char*>(data), size);
+}
+
+void append_utf8_replacing_invalid(std::string& out, std::string_view value) {
+    const auto* p = reinterpret_cast<const unsigned char*>(value.data());
+    size_t size = value.size();
+    size_t run_start = 0;
+    size_t pos = 0;
+    
+    while (pos < size) {
+        size_t skip;
+        size_t length = utf8_sequence(p + pos, size - pos, skip);
+        if (length != 0) {
+            pos += length;
+            continue;
+        }
+        
+        out.append(value.data() + run_start, pos - run_start);
+        out.append("\xEF\xBF\xBD", 3);
+        pos += skip;
+        run_start = pos;
+    }
+    
+    out.append(value.data() + run_start, size - run_start);
+}
+
+} // namespace a2a
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace a2a {
+
+/**
+ * @brief Offset of the first '"', '\\' or control character, or size if none
+ *
+ * These are the bytes that end a clean run both when escaping a string
+ * and when scanning a string literal. Checks 16 or 32 bytes per step.
+ */
+size_t find_json_special(const char* data, size_t size);
+
+/**
+ * @brief Whether the bytes are well-formed UTF-8
+ *
+ * Rejects overlong forms, surrogates and code points above U+10FFFF.
+ */
+bool is_valid_utf8(const char* data, size_t size);
+
+/**
+ * @brief Append a copy with each ill-formed sequence replaced by U+FFFD
+ */
+void append_utf8_replacing_invalid(std::string& out, std::string_view value);
+
+} // namespace a2a
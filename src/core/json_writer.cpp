@@ -0,0 +1,255 @@
+#include <a2a/core/json_writer.hpp>
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/base64.hpp>
+#include "json_scan.hpp"
+#include "transcode.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace a2a {
+
+namespace {
+
+// Escape class per byte: 0 = copy as-is, 'u' = \u00XX, otherwise the
+// character that follows the backslash.
+struct EscapeTable {
+    char cls[256];
+    
+    constexpr EscapeTable() : cls() {
+        for (int c = 0; c < 0x20; ++c) {
+            cls[c] = 'u';
+        }
+        cls[static_cast<unsigned char>('"')] = '"';
+        cls[static_cast<unsigned char>('\\')] = '\\';
+        cls[static_cast<unsigned char>('\b')] = 'b';
+        cls[static_cast<unsigned char>('\f')] = 'f';
+        cls[static_cast<unsigned char>('\n')] = 'n';
+        cls[static_cast<unsigned char>('\r')] = 'r';
+        cls[static_cast<unsigned char>('\t')] = 't';
+    }
+};
+
+constexpr EscapeTable kEscape;
+
+} // namespace
+
+void append_json_escaped(std::string& out, std::string_view value) {
+    static const char* hex = "0123456789abcdef";
+    
+    // JSON text must be UTF-8; repair rather than emit a document peers
+    // will reject
+    if (!is_valid_utf8(value.data(), value.size())) {
+        std::string repaired;
+        append_utf8_replacing_invalid(repaired, value);
+        append_json_escaped(out, repaired);
+        return;
+    }
+    
+    const char* data = value.data();
+    size_t size = value.size();
+    size_t pos = 0;
+    
+    for (;;) {
+        // Copy the clean run up to the next byte needing an escape in one append
+        size_t special = pos + find_json_special(data + pos, size - pos);
+        out.append(data + pos, special - pos);
+        if (special == size) {
+            break;
+        }
+        
+        unsigned char c = static_cast<unsigned char>(data[special]);
+        char cls = kEscape.cls[c];
+        if (cls == 'u') {
+            char buf[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0x0f]};
+            out.append(buf, sizeof(buf));
+        } else {
+            char buf[2] = {'\\', cls};
+            out.append(buf, sizeof(buf));
+        }
+        pos = special + 1;
+    }
+}
+
+void JsonWriter::key(std::string_view name) {
+    if (cbor_) {
+        cbor_text(name);
+        return;
+    }
+    
+    separate();
+    out_.push_back('"');
+    append_json_escaped(out_, name);
+    out_.append("\":", 2);
+    need_comma_ = false;
+}
+
+void JsonWriter::string(std::string_view value) {
+    if (cbor_) {
+        cbor_text(value);
+        return;
+    }
+    
+    separate();
+    out_.push_back('"');
+    append_json_escaped(out_, value);
+    out_.push_back('"');
+    need_comma_ = true;
+}
+
+void JsonWriter::integer(int64_t value) {
+    if (cbor_) {
+        // Negative n is encoded as -1 - n, which cannot overflow
+        if (value >= 0) {
+            cbor_head(0, static_cast<uint64_t>(value));
+        } else {
+            cbor_head(1, static_cast<uint64_t>(-1 - value));
+        }
+        return;
+    }
+    
+    separate();
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out_.append(buf, static_cast<size_t>(result.ptr - buf));
+    need_comma_ = true;
+}
+
+void JsonWriter::floating(double value) {
+    if (cbor_) {
+        // Single precision when that loses nothing
+        float narrow = static_cast<float>(value);
+        if (static_cast<double>(narrow) == value) {
+            uint32_t bits;
+            std::memcpy(&bits, &narrow, sizeof(bits));
+            out_.push_back('\xFA');
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                out_.push_back(static_cast<char>(bits >> shift));
+            }
+        } else {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            out_.push_back('\xFB');
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                out_.push_back(static_cast<char>(bits >> shift));
+            }
+        }
+        return;
+    }
+    
+    if (!std::isfinite(value)) {
+        null();
+        return;
+    }
+    separate();
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out_.append(buf, static_cast<size_t>(result.ptr - buf));
+    need_comma_ = true;
+}
+
+void JsonWriter::boolean(bool value) {
+    if (cbor_) {
+        out_.push_back(value ? '\xF5' : '\xF4');
+        return;
+    }
+    
+    separate();
+    if (value) {
+        out_.append("true", 4);
+    } else {
+        out_.append("false", 5);
+    }
+    need_comma_ = true;
+}
+
+void JsonWriter::null() {
+    if (cbor_) {
+        out_.push_back('\xF6');
+        return;
+    }
+    
+    separate();
+    out_.append("null", 4);
+    need_comma_ = true;
+}
+
+void JsonWriter::bytes(const uint8_t* data, size_t size) {
+    if (cbor_) {
+        cbor_head(2, size);
+        out_.append(reinterpret_cast<const char*>(data), size);
+        return;
+    }
+    
+    unescaped_string(base64_encoded_size(size), [data, size](char* out) {
+        base64_encode(data, size, out);
+    });
+}
+
+void JsonWriter::raw(std::string_view fragment) {
+    if (fragment.empty()) {
+        null();
+        return;
+    }
+    
+    separate();
+    out_.append(fragment.data(), fragment.size());
+    need_comma_ = true;
+}
+
+void JsonWriter::json_text(std::string_view fragment) {
+    if (!cbor_ || fragment.empty()) {
+        raw(fragment);
+        return;
+    }
+    
+    JsonReader reader(fragment);
+    transcode_value(reader, *this);
+}
+
+char* JsonWriter::reserve_string(size_t length) {
+    size_t start = out_.size();
+    if (cbor_) {
+        cbor_head(3, length);
+        start = out_.size();
+        out_.resize(start + length);
+        return &out_[start];
+    }
+    
+    separate();
+    start = out_.size();
+    out_.resize(start + length + 2);
+    out_[start] = '"';
+    out_[start + length + 1] = '"';
+    return &out_[start + 1];
+}
+
+void JsonWriter::cbor_head(uint8_t major, uint64_t argument) {
+    char initial = static_cast<char>(major << 5);
+    if (argument < 24) {
+        out_.push_back(static_cast<char>(initial | argument));
+        return;
+    }
+    
+    // Additional info 24..27 announces a 1, 2, 4 or 8 byte big-endian argument
+    int size_code = argument <= 0xFF ? 0 : argument <= 0xFFFF ? 1 : argument <= 0xFFFFFFFF ? 2 : 3;
+    out_.push_back(static_cast<char>(initial | (24 + size_code)));
+    for (int shift = (8 << size_code) - 8; shift >= 0; shift -= 8) {
+        out_.push_back(static_cast<char>(argument >> shift));
+    }
+}
+
+void JsonWriter::cbor_text(std::string_view value) {
+    // Text strings must be UTF-8, as in JSON
+    if (!is_valid_utf8(value.data(), value.size())) {
+        std::string repaired;
+        append_utf8_replacing_invalid(repaired, value);
+        cbor_text(repaired);
+        return;
+    }
+    
+    cbor_head(3, value.size());
+    out_.append(value.data(), value.size());
+}
+
+} // namespace a2a
@@ -1,68 +1,61 @@
 #include <a2a/core/jsonrpc_request.hpp>
+#include <a2a/core/json_reader.hpp>
 #include <a2a/core/exception.hpp>
-#include <json.hpp>
-
-using json = nlohmann::json;
 
 namespace a2a {
 
 std::string JsonRpcRequest::to_json() const {
-    try {
-        json j;
-        j["jsonrpc"] = jsonrpc_;
-        j["id"] = id_;
-        j["method"] = method_;
-        
-        if (!params_json_.empty() && params_json_ != "{}") {
-            // Parse params_json_ as JSON object and add it
-            j["params"] = json::parse(params_json_);
-        }
-        
-        return j.dump();
-    } catch (const json::exception& e) {
-        throw A2AException(
-            std::string("JSON serialization error: ") + e.what(),
-            ErrorCode::InternalError
-        );
+    std::string out;
+    out.reserve(params_json_.size() + id_.size() + method_.size() + 48);
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void JsonRpcRequest::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("jsonrpc", jsonrpc_);
+    writer.string_field("id", id_);
+    writer.string_field("method", method_);
+    
+    if (!params_json_.empty() && params_json_ != "{}") {
+        // Params are already serialized JSON; splice them in as-is
+        writer.json_text_field("params", params_json_);
     }
+    
+    writer.end_object();
 }
 
-JsonRpcRequest JsonRpcRequest::from_json(const std::string& json_str) {
-    try {
-        json j = json::parse(json_str);
-        
-        JsonRpcRequest request;
-        
-        // Extract required fields
-        if (j.contains("jsonrpc")) {
-            request.jsonrpc_ = j["jsonrpc"].get<std::string>();
-        }
-        
-        if (j.contains("id")) {
+JsonRpcRequest JsonRpcRequest::from_json(std::string_view json) {
+    JsonReader reader(json);
+    JsonRpcRequest request;
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "jsonrpc") {
+            request.jsonrpc_ = reader.read_string();
+        } else if (key == "id") {
             // Handle both string and numeric IDs
-            if (j["id"].is_string()) {
-                request.id_ = j["id"].get<std::string>();
-            } else if (j["id"].is_number()) {
-                request.id_ = std::to_string(j["id"].get<int>());
+            auto type = reader.peek();
+            if (type == JsonReader::Type::String) {
+                request.id_ = reader.read_string();
+            } else if (type == JsonReader::Type::Number) {
+                request.id_ = std::to_string(reader.read_int());
+            } else {
+                reader.skip_value();
             }
+        } else if (key == "method") {
+            request.method_ = reader.read_string();
+        } else if (key == "params") {
+            // Keep params as their original JSON text
+            request.params_json_ = std::string(reader.read_raw());
+        } else {
+            reader.skip_value();
         }
-        
-        if (j.contains("method")) {
-            request.method_ = j["method"].get<std::string>();
-        }
-        
-        // Extract params as JSON string
-        if (j.contains("params")) {
-            request.params_json_ = j["params"].dump();
-        }
-        
-        return request;
-    } catch (const json::exception& e) {
-        throw A2AException(
-            std::string("JSON parsing error: ") + e.what(),
-            ErrorCode::ParseError
-        );
     }
+    
+    return request;
 }
 
 } // namespace a2a
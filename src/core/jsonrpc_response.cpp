@@ -1,109 +1,122 @@
 #include <a2a/core/jsonrpc_response.hpp>
+#include <a2a/core/json_reader.hpp>
 #include <a2a/core/exception.hpp>
-#include <json.hpp>
-
-using json = nlohmann::json;
 
 namespace a2a {
 
 std::string JsonRpcResponse::to_json() const {
-    try {
-        json j;
-        j["jsonrpc"] = jsonrpc_;
-        j["id"] = id_;
+    std::string out;
+    out.reserve((result_json_ ? result_json_->size() : 0) + id_.size() + 48);
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void JsonRpcResponse::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("jsonrpc", jsonrpc_);
+    writer.string_field("id", id_);
+    
+    if (result_json_.has_value()) {
+        // Result is already serialized JSON; splice it in as-is
+        writer.json_text_field("result", *result_json_);
+    } else if (error_.has_value()) {
+        writer.key("error");
+        writer.begin_object();
+        writer.integer_field("code", error_->code);
+        writer.string_field("message", error_->message);
         
-        if (result_json_.has_value()) {
-            // Parse result_json_ as JSON and add it
-            j["result"] = json::parse(*result_json_);
-        } else if (error_.has_value()) {
-            json error_obj;
-            error_obj["code"] = error_->code;
-            error_obj["message"] = error_->message;
-            
-            if (!error_->data.empty()) {
-                error_obj["data"] = error_->data;
-            }
-            
-            j["error"] = error_obj;
+        if (!error_->data.empty()) {
+            writer.string_field("data", error_->data);
         }
         
-        return j.dump();
-    } catch (const json::exception& e) {
-        throw A2AException(
-            std::string("JSON serialization error: ") + e.what(),
-            ErrorCode::InternalError
-        );
+        writer.end_object();
     }
+    
+    writer.end_object();
 }
 
-JsonRpcResponse JsonRpcResponse::from_json(const std::string& json_str) {
-    try {
-        json j = json::parse(json_str);
-        
-        JsonRpcResponse response;
-        
-        // Extract required fields
-        if (j.contains("jsonrpc")) {
-            response.jsonrpc_ = j["jsonrpc"].get<std::string>();
-        }
-        
-        if (j.contains("id")) {
+JsonRpcResponse JsonRpcResponse::from_json(std::string_view json) {
+    return JsonRpcResponseView::parse(json).to_response();
+}
+
+JsonRpcResponse JsonRpcResponse::create_error(const std::string& id,
+                                             ErrorCode code,
+                                             const std::string& message) {
+    return JsonRpcResponse(id, JsonRpcError(code, message));
+}
+
+JsonRpcResponse JsonRpcResponse::create_success(const std::string& id,
+                                               std::string result_json) {
+    return JsonRpcResponse(id, std::move(result_json));
+}
+
+// JsonRpcResponseView implementation
+JsonRpcResponseView JsonRpcResponseView::parse(std::string_view data, WireFormat format) {
+    JsonReader reader(data, format);
+    JsonRpcResponseView view;
+    view.format_ = format;
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "id") {
             // Handle both string and numeric IDs
-            if (j["id"].is_string()) {
-                response.id_ = j["id"].get<std::string>();
-            } else if (j["id"].is_number()) {
-                response.id_ = std::to_string(j["id"].get<int>());
-            } else if (j["id"].is_null()) {
-                response.id_ = "";
+            auto type = reader.peek();
+            if (type == JsonReader::Type::String) {
+                view.id_ = reader.read_string();
+            } else if (type == JsonReader::Type::Number) {
+                view.id_ = std::to_string(reader.read_int());
+            } else {
+                reader.skip_value();
             }
-        }
-        
-        // Check for result
-        if (j.contains("result")) {
-            response.result_json_ = j["result"].dump();
-        }
-        
-        // Check for error
-        if (j.contains("error") && j["error"].is_object()) {
+        } else if (key == "result") {
+            view.result_ = reader.read_raw();
+        } else if (key == "error" && reader.peek() == JsonReader::Type::Object) {
             JsonRpcError error;
             
-            if (j["error"].contains("code")) {
-                error.code = j["error"]["code"].get<int>();
-            }
-            
-            if (j["error"].contains("message")) {
-                error.message = j["error"]["message"].get<std::string>();
-            }
-            
-            if (j["error"].contains("data")) {
-                if (j["error"]["data"].is_string()) {
-                    error.data = j["error"]["data"].get<std::string>();
+            reader.begin_object();
+            std::string_view error_key;
+            while (reader.next_key(error_key)) {
+                if (error_key == "code") {
+                    error.code = static_cast<int32_t>(reader.read_int());
+                } else if (error_key == "message") {
+                    error.message = reader.read_string();
+                } else if (error_key == "data") {
+                    if (reader.peek() == JsonReader::Type::String) {
+                        error.data = reader.read_string();
+                    } else {
+                        error.data = std::string(reader.read_json_text());
+                    }
                 } else {
-                    error.data = j["error"]["data"].dump();
+                    reader.skip_value();
                 }
             }
             
-            response.error_ = error;
+            view.error_ = std::move(error);
+        } else {
+            reader.skip_value();
         }
-        
-        return response;
-    } catch (const json::exception& e) {
-        throw A2AException(
-            std::string("JSON parsing error: ") + e.what(),
-            ErrorCode::ParseError
-        );
     }
+    
+    return view;
 }
 
-JsonRpcResponse JsonRpcResponse::create_error(const std::string& id,
-                                             ErrorCode code,
-                                             const std::string& message) {
-    return JsonRpcResponse(id, JsonRpcError(code, message));
-}
-
-JsonRpcResponse JsonRpcResponse::create_success(const std::string& id,
-                                               const std::string& result_json) {
-    return JsonRpcResponse(id, result_json);
+JsonRpcResponse JsonRpcResponseView::to_response() const {
+    if (error_.has_value()) {
+        return JsonRpcResponse(id_, *error_);
+    }
+    
+    if (result_.has_value()) {
+        if (format_ == WireFormat::Cbor) {
+            return JsonRpcResponse(id_, transcode(*result_, format_, WireFormat::Json));
+        }
+        return JsonRpcResponse(id_, std::string(*result_));
+    }
+    
+    JsonRpcResponse response;
+    response.id_ = id_;
+    return response;
 }
 
 } // namespace a2a
@@ -0,0 +1,127 @@
+#include <a2a/core/sse_parser.hpp>
+
+namespace a2a {
+
+void SseParser::feed(std::string_view chunk) {
+    if (!started_ && !chunk.empty()) {
+        started_ = true;
+        // A UTF-8 byte order mark may precede the first line
+        if (chunk.substr(0, 3) == "\xEF\xBB\xBF") {
+            chunk.remove_prefix(3);
+        }
+    }
+    
+    size_t pos = 0;
+    
+    // A CRLF split across chunks is one line ending
+    if (pending_cr_) {
+        pending_cr_ = false;
+        if (!chunk.empty() && chunk[0] == '\n') {
+            pos = 1;
+        }
+    }
+    
+    while (pos < chunk.size()) {
+        size_t end = chunk.find_first_of("\r\n", pos);
+        if (end == std::string_view::npos) {
+            line_.append(chunk.data() + pos, chunk.size() - pos);
+            return;
+        }
+        
+        std::string_view line = chunk.substr(pos, end - pos);
+        if (line_.empty()) {
+            process_line(line);
+        } else {
+            line_.append(line.data(), line.size());
+            process_line(line_);
+            line_.clear();
+        }
+        
+        if (chunk[end] == '\r') {
+            if (end + 1 == chunk.size()) {
+                pending_cr_ = true;
+            } else if (chunk[end + 1] == '\n') {
+                ++end;
+            }
+        }
+        pos = end + 1;
+    }
+}
+
+void SseParser::reset() {
+    line_.clear();
+    data_.clear();
+    event_.clear();
+    has_data_ = false;
+    pending_cr_ = false;
+}
+
+void SseParser::process_line(std::string_view line) {
+    if (line.empty()) {
+        dispatch();
+        return;
+    }
+    if (line[0] == ':') {
+        return;     // comment (e.g. keep-alive)
+    }
+    
+    std::string_view field = line;
+    std::string_view value;
+    size_t colon = line.find(':');
+    if (colon != std::string_view::npos) {
+        field = line.substr(0, colon);
+        value = line.substr(colon + 1);
+        if (!value.empty() && value[0] == ' ') {
+            value.remove_prefix(1);
+        }
+    }
+    
+    if (field == "data") {
+        if (has_data_) {
+            data_.push_back('\n');
+        }
+        data_.append(value.data(), value.size());
+        has_data_ = true;
+    } else if (field == "event") {
+        event_.assign(value.data(), value.size());
+    } else if (field == "id") {
+        if (value.find('\0') == std::string_view::npos) {
+            last_event_id_.assign(value.data(), value.size());
+        }
+    } else if (field == "retry") {
+        if (!value.empty() && value.size() <= 12 &&
+            value.find_first_not_of("0123456789") == std::string_view::npos) {
+            long ms = 0;
+            for (char c : value) {
+                ms = ms * 10 + (c - '0');
+            }
+            retry_ = ms;
+        }
+    }
+}
+
+void SseParser::dispatch() {
+    if (!has_data_) {
+        event_.clear();
+        return;
+    }
+    
+    SseEvent event;
+    event.event = event_.empty() ? std::string_view("message") : std::string_view(event_);
+    event.data = data_;
+    event.id = last_event_id_;
+    
+    // Buffers are cleared (capacity kept) even if the callback throws
+    struct Clear {
+        SseParser& parser;
+        ~Clear() {
+            parser.data_.clear();
+            parser.event_.clear();
+            parser.has_data_ = false;
+        }
+    } clear{*this};
+    
+    on_event_(event);
+}
+
+} // namespace a2a
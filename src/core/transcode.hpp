@@ -0,0 +1,17 @@
+#pragma once
+
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/json_writer.hpp>
+
+namespace a2a {
+
+/**
+ * @brief Copy the reader's next value to the writer
+ *
+ * The two may use different wire formats; byte strings become base64 in
+ * JSON. Nesting is limited to keep hostile input from exhausting the stack.
+ * @throws A2AException with ErrorCode::ParseError on malformed input
+ */
+void transcode_value(JsonReader& from, JsonWriter& to);
+
+} // namespace a2a
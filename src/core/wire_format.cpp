@@ -0,0 +1,101 @@
+#include <a2a/core/wire_format.hpp>
+#include <a2a/core/exception.hpp>
+#include "transcode.hpp"
+#include <cctype>
+
+namespace a2a {
+
+namespace {
+
+constexpr size_t MAX_TRANSCODE_DEPTH = 512;
+
+void copy_value(JsonReader& from, JsonWriter& to, size_t depth) {
+    if (depth > MAX_TRANSCODE_DEPTH) {
+        throw A2AException("Value nested too deeply", ErrorCode::ParseError);
+    }
+    
+    switch (from.peek()) {
+        case JsonReader::Type::Null:
+            from.consume_null();
+            to.null();
+            break;
+        case JsonReader::Type::Boolean:
+            to.boolean(from.read_bool());
+            break;
+        case JsonReader::Type::Number:
+            if (from.peek_integer()) {
+                to.integer(from.read_int());
+            } else {
+                to.floating(from.read_double());
+            }
+            break;
+        case JsonReader::Type::String:
+            to.string(from.read_string_view());
+            break;
+        case JsonReader::Type::Bytes: {
+            std::vector<uint8_t> data = from.read_bytes();
+            to.bytes(data.data(), data.size());
+            break;
+        }
+        case JsonReader::Type::Object: {
+            from.begin_object();
+            to.begin_object();
+            std::string_view key;
+            while (from.next_key(key)) {
+                to.key(key);
+                copy_value(from, to, depth + 1);
+            }
+            to.end_object();
+            break;
+        }
+        case JsonReader::Type::Array:
+            from.begin_array();
+            to.begin_array();
+            while (from.next_element()) {
+                copy_value(from, to, depth + 1);
+            }
+            to.end_array();
+            break;
+    }
+}
+
+} // namespace
+
+void transcode_value(JsonReader& from, JsonWriter& to) {
+    copy_value(from, to, 0);
+}
+
+WireFormat wire_format_from_content_type(std::string_view content_type) {
+    constexpr std::string_view cbor = "application/cbor";
+    
+    // Media types are case-insensitive and may carry parameters
+    size_t end = content_type.find(';');
+    std::string_view media_type = content_type.substr(0, end);
+    while (!media_type.empty() && (media_type.back() == ' ' || media_type.back() == '\t')) {
+        media_type.remove_suffix(1);
+    }
+    while (!media_type.empty() && (media_type.front() == ' ' || media_type.front() == '\t')) {
+        media_type.remove_prefix(1);
+    }
+    
+    if (media_type.size() != cbor.size()) {
+        return WireFormat::Json;
+    }
+    for (size_t i = 0; i < cbor.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(media_type[i])) != cbor[i]) {
+            return WireFormat::Json;
+        }
+    }
+    return WireFormat::Cbor;
+}
+
+std::string transcode(std::string_view value, WireFormat from, WireFormat to) {
+    std::string out;
+    out.reserve(value.size());
+    JsonReader reader(value, from);
+    JsonWriter writer(out, to);
+    transcode_value(reader, writer);
+    return out;
+}
+
+} // namespace a2a
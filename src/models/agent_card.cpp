@@ -1,73 +1,103 @@
 #include <a2a/models/agent_card.hpp>
-#include <sstream>
 
 namespace a2a {
 
 // AgentCapabilities implementation
 std::string AgentCapabilities::to_json() const {
-    std::ostringstream oss;
-    oss << "{"
-        << "\"streaming\":" << (streaming ? "true" : "false") << ","
-        << "\"pushNotifications\":" << (push_notifications ? "true" : "false") << ","
-        << "\"taskManagement\":" << (task_management ? "true" : "false")
-        << "}";
-    return oss.str();
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
 }
 
-AgentCapabilities AgentCapabilities::from_json(const std::string& json) {
+void AgentCapabilities::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.bool_field("streaming", streaming);
+    writer.bool_field("pushNotifications", push_notifications);
+    writer.bool_field("taskManagement", task_management);
+    writer.end_object();
+}
+
+AgentCapabilities AgentCapabilities::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
+}
+
+AgentCapabilities AgentCapabilities::read_json(JsonReader& reader) {
     AgentCapabilities caps;
-    caps.streaming = json.find("\"streaming\":true") != std::string::npos;
-    caps.push_notifications = json.find("\"pushNotifications\":true") != std::string::npos;
-    caps.task_management = json.find("\"taskManagement\":true") != std::string::npos;
+    caps.task_management = false;
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.peek() != JsonReader::Type::Boolean) {
+            reader.skip_value();
+        } else if (key == "streaming") {
+            caps.streaming = reader.read_bool();
+        } else if (key == "pushNotifications" || key == "push_notifications") {
+            caps.push_notifications = reader.read_bool();
+        } else if (key == "taskManagement" || key == "task_management") {
+            caps.task_management = reader.read_bool();
+        } else {
+            reader.skip_value();
+        }
+    }
+    
     return caps;
 }
 
 // AgentSkill implementation
 std::string AgentSkill::to_json() const {
-    std::ostringstream oss;
-    oss << "{"
-        << "\"name\":\"" << name << "\","
-        << "\"description\":\"" << description << "\"";
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void AgentSkill::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("name", name);
+    writer.string_field("description", description);
     
     if (!input_modes.empty()) {
-        oss << ",\"inputModes\":[";
-        for (size_t i = 0; i < input_modes.size(); ++i) {
-            if (i > 0) oss << ",";
-            oss << "\"" << input_modes[i] << "\"";
-        }
-        oss << "]";
+        writer.key("inputModes");
+        writer.string_array(input_modes);
     }
     
     if (!output_modes.empty()) {
-        oss << ",\"outputModes\":[";
-        for (size_t i = 0; i < output_modes.size(); ++i) {
-            if (i > 0) oss << ",";
-            oss << "\"" << output_modes[i] << "\"";
-        }
-        oss << "]";
+        writer.key("outputModes");
+        writer.string_array(output_modes);
     }
     
-    oss << "}";
-    return oss.str();
+    writer.end_object();
 }
 
-AgentSkill AgentSkill::from_json(const std::string& json) {
+AgentSkill AgentSkill::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
+}
+
+AgentSkill AgentSkill::read_json(JsonReader& reader) {
     AgentSkill skill;
     
-    // Extract name
-    size_t name_pos = json.find("\"name\":");
-    if (name_pos != std::string::npos) {
-        size_t start = json.find("\"", name_pos + 7) + 1;
-        size_t end = json.find("\"", start);
-        skill.name = json.substr(start, end - start);
-    }
-    
-    // Extract description
-    size_t desc_pos = json.find("\"description\":");
-    if (desc_pos != std::string::npos) {
-        size_t start = json.find("\"", desc_pos + 14) + 1;
-        size_t end = json.find("\"", start);
-        skill.description = json.substr(start, end - start);
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "name") {
+            skill.name = reader.read_string();
+        } else if (key == "description") {
+            skill.description = reader.read_string();
+        } else if (key == "inputModes" || key == "input_modes") {
+            reader.read_string_array(skill.input_modes);
+        } else if (key == "outputModes" || key == "output_modes") {
+            reader.read_string_array(skill.output_modes);
+        } else {
+            reader.skip_value();
+        }
     }
     
     return skill;
@@ -75,36 +105,48 @@ AgentSkill AgentSkill::from_json(const std::string& json) {
 
 // AgentProvider implementation
 std::string AgentProvider::to_json() const {
-    std::ostringstream oss;
-    oss << "{"
-        << "\"name\":\"" << name << "\","
-        << "\"organization\":\"" << organization << "\"";
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void AgentProvider::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("name", name);
+    writer.string_field("organization", organization);
     
     if (url.has_value()) {
-        oss << ",\"url\":\"" << *url << "\"";
+        writer.string_field("url", *url);
     }
     
-    oss << "}";
-    return oss.str();
+    writer.end_object();
+}
+
+AgentProvider AgentProvider::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
 }
 
-AgentProvider AgentProvider::from_json(const std::string& json) {
+AgentProvider AgentProvider::read_json(JsonReader& reader) {
     AgentProvider provider;
     
-    // Extract name
-    size_t name_pos = json.find("\"name\":");
-    if (name_pos != std::string::npos) {
-        size_t start = json.find("\"", name_pos + 7) + 1;
-        size_t end = json.find("\"", start);
-        provider.name = json.substr(start, end - start);
-    }
-    
-    // Extract organization
-    size_t org_pos = json.find("\"organization\":");
-    if (org_pos != std::string::npos) {
-        size_t start = json.find("\"", org_pos + 15) + 1;
-        size_t end = json.find("\"", start);
-        provider.organization = json.substr(start, end - start);
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "name") {
+            provider.name = reader.read_string();
+        } else if (key == "organization") {
+            provider.organization = reader.read_string();
+        } else if (key == "url") {
+            provider.url = reader.read_string();
+        } else {
+            reader.skip_value();
+        }
     }
     
     return provider;
@@ -112,126 +154,110 @@ AgentProvider AgentProvider::from_json(const std::string& json) {
 
 // AgentCard implementation
 std::string AgentCard::to_json() const {
-    std::ostringstream oss;
-    oss << "{";
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void AgentCard::write_json(JsonWriter& writer) const {
+    writer.begin_object();
     
     // Required fields
-    oss << "\"name\":\"" << name_ << "\",";
-    oss << "\"description\":\"" << description_ << "\",";
-    oss << "\"url\":\"" << url_ << "\",";
-    oss << "\"version\":\"" << version_ << "\",";
-    oss << "\"protocolVersion\":\"" << protocol_version_ << "\",";
-    oss << "\"capabilities\":" << capabilities_.to_json() << ",";
-    
-    // Default input modes
-    oss << "\"defaultInputModes\":[";
-    for (size_t i = 0; i < default_input_modes_.size(); ++i) {
-        if (i > 0) oss << ",";
-        oss << "\"" << default_input_modes_[i] << "\"";
-    }
-    oss << "],";
+    writer.string_field("name", name_);
+    writer.string_field("description", description_);
+    writer.string_field("url", url_);
+    writer.string_field("version", version_);
+    writer.string_field("protocolVersion", protocol_version_);
+    writer.key("capabilities");
+    capabilities_.write_json(writer);
     
-    // Default output modes
-    oss << "\"defaultOutputModes\":[";
-    for (size_t i = 0; i < default_output_modes_.size(); ++i) {
-        if (i > 0) oss << ",";
-        oss << "\"" << default_output_modes_[i] << "\"";
-    }
-    oss << "],";
+    // Default input/output modes
+    writer.key("defaultInputModes");
+    writer.string_array(default_input_modes_);
+    writer.key("defaultOutputModes");
+    writer.string_array(default_output_modes_);
     
     // Skills
-    oss << "\"skills\":[";
-    for (size_t i = 0; i < skills_.size(); ++i) {
-        if (i > 0) oss << ",";
-        oss << skills_[i].to_json();
+    writer.key("skills");
+    writer.begin_array();
+    for (const auto& skill : skills_) {
+        skill.write_json(writer);
     }
-    oss << "],";
+    writer.end_array();
     
     // Preferred transport
-    oss << "\"preferredTransport\":\"" 
-        << (preferred_transport_ == AgentTransport::JsonRpc ? "jsonrpc" : "http") 
-        << "\"";
+    writer.string_field("preferredTransport",
+                        preferred_transport_ == AgentTransport::JsonRpc ? "jsonrpc" : "http");
     
     // Optional fields
     if (icon_url_.has_value()) {
-        oss << ",\"iconUrl\":\"" << *icon_url_ << "\"";
+        writer.string_field("iconUrl", *icon_url_);
     }
     
     if (documentation_url_.has_value()) {
-        oss << ",\"documentationUrl\":\"" << *documentation_url_ << "\"";
+        writer.string_field("documentationUrl", *documentation_url_);
     }
     
     if (provider_.has_value()) {
-        oss << ",\"provider\":" << provider_->to_json();
+        writer.key("provider");
+        provider_->write_json(writer);
     }
     
-    oss << "}";
-    return oss.str();
+    writer.end_object();
 }
 
-AgentCard AgentCard::from_json(const std::string& json) {
+AgentCard AgentCard::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
+}
+
+AgentCard AgentCard::read_json(JsonReader& reader) {
     AgentCard card;
     
-    // Extract name
-    size_t name_pos = json.find("\"name\":");
-    if (name_pos != std::string::npos) {
-        size_t start = json.find("\"", name_pos + 7) + 1;
-        size_t end = json.find("\"", start);
-        card.name_ = json.substr(start, end - start);
-    }
-    
-    // Extract description
-    size_t desc_pos = json.find("\"description\":");
-    if (desc_pos != std::string::npos) {
-        size_t start = json.find("\"", desc_pos + 14) + 1;
-        size_t end = json.find("\"", start);
-        card.description_ = json.substr(start, end - start);
-    }
-    
-    // Extract url
-    size_t url_pos = json.find("\"url\":");
-    if (url_pos != std::string::npos) {
-        size_t start = json.find("\"", url_pos + 6) + 1;
-        size_t end = json.find("\"", start);
-        card.url_ = json.substr(start, end - start);
-    }
-    
-    // Extract version
-    size_t ver_pos = json.find("\"version\":");
-    if (ver_pos != std::string::npos) {
-        size_t start = json.find("\"", ver_pos + 10) + 1;
-        size_t end = json.find("\"", start);
-        card.version_ = json.substr(start, end - start);
-    }
-    
-    // Extract protocolVersion
-    size_t proto_pos = json.find("\"protocolVersion\":");
-    if (proto_pos != std::string::npos) {
-        size_t start = json.find("\"", proto_pos + 18) + 1;
-        size_t end = json.find("\"", start);
-        card.protocol_version_ = json.substr(start, end - start);
-    }
-    
-    // Extract capabilities
-    size_t caps_pos = json.find("\"capabilities\":");
-    if (caps_pos != std::string::npos) {
-        size_t start = caps_pos + 15;
-        size_t brace_count = 0;
-        size_t end = start;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
         
-        for (size_t i = start; i < json.length(); ++i) {
-            if (json[i] == '{') brace_count++;
-            else if (json[i] == '}') {
-                brace_count--;
-                if (brace_count == 0) {
-                    end = i + 1;
-                    break;
-                }
+        if (key == "name") {
+            card.name_ = reader.read_string();
+        } else if (key == "description") {
+            card.description_ = reader.read_string();
+        } else if (key == "url") {
+            card.url_ = reader.read_string();
+        } else if (key == "version") {
+            card.version_ = reader.read_string();
+        } else if (key == "protocolVersion") {
+            card.protocol_version_ = reader.read_string();
+        } else if (key == "iconUrl") {
+            card.icon_url_ = reader.read_string();
+        } else if (key == "documentationUrl") {
+            card.documentation_url_ = reader.read_string();
+        } else if (key == "capabilities") {
+            card.capabilities_ = AgentCapabilities::read_json(reader);
+        } else if (key == "defaultInputModes") {
+            card.default_input_modes_.clear();
+            reader.read_string_array(card.default_input_modes_);
+        } else if (key == "defaultOutputModes") {
+            card.default_output_modes_.clear();
+            reader.read_string_array(card.default_output_modes_);
+        } else if (key == "skills") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                card.skills_.push_back(AgentSkill::read_json(reader));
             }
+        } else if (key == "preferredTransport") {
+            card.preferred_transport_ = reader.read_string_view() == "http"
+                ? AgentTransport::Http
+                : AgentTransport::JsonRpc;
+        } else if (key == "provider") {
+            card.provider_ = AgentProvider::read_json(reader);
+        } else {
+            reader.skip_value();
         }
-        
-        std::string caps_json = json.substr(start, end - start);
-        card.capabilities_ = AgentCapabilities::from_json(caps_json);
     }
     
     return card;
@@ -0,0 +1,86 @@
+#include <a2a/models/agent_message_view.hpp>
+#include <a2a/core/json_reader.hpp>
+
+namespace a2a {
+
+MessagePart AgentMessageView::part(size_t index) const {
+    JsonReader reader(raw_part(index), format_);
+    // Indexed parts all have a known kind, so decoding yields a part
+    return *MessagePart::read_json(reader);
+}
+
+std::string AgentMessageView::get_text() const {
+    for (const auto& part : parts_) {
+        if (part.kind == PartKind::Text && !part.text.empty()) {
+            JsonReader reader(part.text, format_);
+            return reader.consume_null() ? std::string() : reader.read_string();
+        }
+    }
+    return "";
+}
+
+AgentMessage AgentMessageView::to_message(std::pmr::memory_resource* resource) const {
+    JsonReader reader(raw_, format_);
+    return AgentMessage::read_json(reader, resource);
+}
+
+AgentMessageView AgentMessageView::parse(std::string_view data, WireFormat format) {
+    JsonReader reader(data, format);
+    return read_json(reader);
+}
+
+AgentMessageView AgentMessageView::read_json(JsonReader& reader) {
+    AgentMessageView view;
+    view.format_ = reader.format();
+    
+    size_t start = reader.mark();
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "messageId") {
+            view.message_id_ = reader.read_string();
+        } else if (key == "role") {
+            view.role_ = message_role_from_string(reader.read_string_view());
+        } else if (key == "contextId") {
+            view.context_id_ = reader.read_string();
+        } else if (key == "taskId") {
+            view.task_id_ = reader.read_string();
+        } else if (key == "parts") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                // Only "kind" is examined; "text" is located but not decoded
+                std::optional<PartKind> kind;
+                std::string_view text;
+                
+                size_t part_start = reader.mark();
+                reader.begin_object();
+                std::string_view part_key;
+                while (reader.next_key(part_key)) {
+                    if (part_key == "kind" && reader.peek() == JsonReader::Type::String) {
+                        kind = part_kind_from_string(reader.read_string_view());
+                    } else if (part_key == "text") {
+                        text = reader.read_raw();
+                    } else {
+                        reader.skip_value();
+                    }
+                }
+                
+                // Unknown kinds are dropped, as MessagePart::read_json does
+                if (kind.has_value()) {
+                    view.parts_.push_back({*kind, reader.span_from(part_start), text});
+                }
+            }
+        } else {
+            reader.skip_value();
+        }
+    }
+    view.raw_ = reader.span_from(start);
+    
+    return view;
+}
+
+} // namespace a2a
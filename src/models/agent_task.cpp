@@ -1,106 +1,88 @@
 #include <a2a/models/agent_task.hpp>
-#include <sstream>
 
 namespace a2a {
 
 std::string AgentTask::to_json() const {
-    std::ostringstream oss;
-    oss << "{";
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void AgentTask::write_json(JsonWriter& writer) const {
+    writer.begin_object();
     
     // Required fields
-    oss << "\"id\":\"" << id_ << "\",";
-    oss << "\"contextId\":\"" << context_id_ << "\",";
-    oss << "\"status\":" << status_.to_json();
+    writer.string_field("id", id_);
+    writer.string_field("contextId", context_id_);
+    writer.key("status");
+    status_.write_json(writer);
     
     // Artifacts array
     if (!artifacts_.empty()) {
-        oss << ",\"artifacts\":[";
-        for (size_t i = 0; i < artifacts_.size(); ++i) {
-            if (i > 0) oss << ",";
-            oss << artifacts_[i].to_json();
+        writer.key("artifacts");
+        writer.begin_array();
+        for (const auto& artifact : artifacts_) {
+            artifact.write_json(writer);
         }
-        oss << "]";
+        writer.end_array();
     }
     
     // History array
     if (!history_.empty()) {
-        oss << ",\"history\":[";
-        for (size_t i = 0; i < history_.size(); ++i) {
-            if (i > 0) oss << ",";
-            oss << history_[i].to_json();
+        writer.key("history");
+        writer.begin_array();
+        for (const auto& message : history_) {
+            message.write_json(writer);
         }
-        oss << "]";
+        writer.end_array();
     }
     
     // Metadata
     if (!metadata_.empty()) {
-        oss << ",\"metadata\":{";
-        bool first = true;
-        for (const auto& [key, value] : metadata_) {
-            if (!first) oss << ",";
-            oss << "\"" << key << "\":\"" << value << "\"";
-            first = false;
-        }
-        oss << "}";
+        writer.key("metadata");
+        writer.string_map(metadata_);
     }
     
-    oss << "}";
-    return oss.str();
+    writer.end_object();
+}
+
+AgentTask AgentTask::from_json(std::string_view json, std::pmr::memory_resource* resource) {
+    JsonReader reader(json);
+    return read_json(reader, resource);
 }
 
-AgentTask AgentTask::from_json(const std::string& json) {
+AgentTask AgentTask::read_json(JsonReader& reader, std::pmr::memory_resource* resource) {
     AgentTask task;
     
-    // Extract id
-    size_t id_pos = json.find("\"id\":");
-    if (id_pos != std::string::npos) {
-        size_t start = json.find("\"", id_pos + 5) + 1;
-        size_t end = json.find("\"", start);
-        task.id_ = json.substr(start, end - start);
-    }
-    
-    // Extract contextId
-    size_t ctx_pos = json.find("\"contextId\":");
-    if (ctx_pos != std::string::npos) {
-        size_t start = json.find("\"", ctx_pos + 12) + 1;
-        size_t end = json.find("\"", start);
-        task.context_id_ = json.substr(start, end - start);
-    }
-    
-    // Extract status
-    size_t status_pos = json.find("\"status\":");
-    if (status_pos != std::string::npos) {
-        size_t start = status_pos + 9;
-        size_t brace_count = 0;
-        size_t end = start;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
         
-        for (size_t i = start; i < json.length(); ++i) {
-            if (json[i] == '{') brace_count++;
-            else if (json[i] == '}') {
-                brace_count--;
-                if (brace_count == 0) {
-                    end = i + 1;
-                    break;
-                }
+        if (key == "id") {
+            task.id_ = reader.read_string();
+        } else if (key == "contextId") {
+            task.context_id_ = reader.read_string();
+        } else if (key == "status") {
+            task.status_ = AgentTaskStatus::read_json(reader);
+        } else if (key == "artifacts") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                task.artifacts_.push_back(Artifact::read_json(reader));
             }
+        } else if (key == "history") {
+            reader.begin_array();
+            while (reader.next_element()) {
+                task.history_.push_back(AgentMessage::read_json(reader, resource));
+            }
+        } else if (key == "metadata") {
+            reader.read_string_map(task.metadata_);
+        } else {
+            reader.skip_value();
         }
-        
-        std::string status_json = json.substr(start, end - start);
-        task.status_ = AgentTaskStatus::from_json(status_json);
-    }
-    
-    // Extract artifacts (simplified)
-    size_t artifacts_pos = json.find("\"artifacts\":[");
-    if (artifacts_pos != std::string::npos) {
-        // Simplified array parsing
-        // In production, use proper JSON library
-    }
-    
-    // Extract history (simplified)
-    size_t history_pos = json.find("\"history\":[");
-    if (history_pos != std::string::npos) {
-        // Simplified array parsing
-        // In production, use proper JSON library
     }
     
     return task;
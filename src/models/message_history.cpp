@@ -0,0 +1,89 @@
+#include <a2a/models/message_history.hpp>
+#include <algorithm>
+
+namespace a2a {
+
+void MessageHistory::set_capacity(size_t capacity) {
+    capacity_ = capacity;
+    if (capacity_ != 0) {
+        trim(capacity_);
+        if (ring_.size() > capacity_) {
+            reallocate(capacity_);
+        }
+    }
+}
+
+uint64_t MessageHistory::push_back(MessagePtr message) {
+    if (capacity_ != 0 && size_ == capacity_) {
+        // Full: the newest takes the oldest's slot
+        ring_[head_] = std::move(message);
+        head_ = (head_ + 1) % ring_.size();
+        return next_sequence_++;
+    }
+    
+    if (size_ == ring_.size()) {
+        size_t slots = std::max<size_t>(ring_.size() * 2, 8);
+        if (capacity_ != 0) {
+            slots = std::min(slots, capacity_);
+        }
+        reallocate(slots);
+    }
+    ring_[(head_ + size_) % ring_.size()] = std::move(message);
+    ++size_;
+    return next_sequence_++;
+}
+
+std::vector<MessageHistory::MessagePtr> MessageHistory::tail(size_t count) const {
+    if (count == 0 || count > size_) {
+        count = size_;
+    }
+    
+    std::vector<MessagePtr> messages;
+    messages.reserve(count);
+    for (size_t i = size_ - count; i < size_; ++i) {
+        messages.push_back(slot(i));
+    }
+    return messages;
+}
+
+std::vector<MessageHistory::MessagePtr> MessageHistory::range(uint64_t from_sequence, size_t count) const {
+    size_t first = 0;
+    if (from_sequence > first_sequence()) {
+        first = static_cast<size_t>(std::min<uint64_t>(from_sequence - first_sequence(), size_));
+    }
+    size_t last = size_;
+    if (count != 0) {
+        last = std::min(size_, first + count);
+    }
+    
+    std::vector<MessagePtr> messages;
+    messages.reserve(last - first);
+    for (size_t i = first; i < last; ++i) {
+        messages.push_back(slot(i));
+    }
+    return messages;
+}
+
+void MessageHistory::trim(size_t max) {
+    while (size_ > max) {
+        ring_[head_].reset();
+        head_ = (head_ + 1) % ring_.size();
+        --size_;
+    }
+}
+
+void MessageHistory::clear() {
+    trim(0);
+    head_ = 0;
+}
+
+void MessageHistory::reallocate(size_t slots) {
+    std::vector<MessagePtr> ring(slots);
+    for (size_t i = 0; i < size_; ++i) {
+        ring[i] = std::move(ring_[(head_ + i) % ring_.size()]);
+    }
+    ring_ = std::move(ring);
+    head_ = 0;
+}
+
+} // namespace a2a
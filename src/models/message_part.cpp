@@ -1,166 +1,159 @@
 #include <a2a/models/message_part.hpp>
-#include <sstream>
-#include <iomanip>
-#include <algorithm>
+#include <new>
+#include <type_traits>
 
 namespace a2a {
 
-// Helper function to escape JSON string
-static std::string escape_json_string(const std::string& input) {
-    std::ostringstream oss;
-    for (unsigned char c : input) {  // Use unsigned char to handle UTF-8 properly
-        switch (c) {
-            case '"':  oss << "\\\""; break;
-            case '\\': oss << "\\\\"; break;
-            case '\b': oss << "\\b"; break;
-            case '\f': oss << "\\f"; break;
-            case '\n': oss << "\\n"; break;
-            case '\r': oss << "\\r"; break;
-            case '\t': oss << "\\t"; break;
-            default:
-                if (c < 0x20) {
-                    // Control characters only (0x00-0x1F)
-                    oss << "\\u" 
-                        << std::hex << std::setw(4) << std::setfill('0') 
-                        << static_cast<int>(c);
-                } else {
-                    // Normal characters including UTF-8 bytes (0x20-0xFF)
-                    oss << static_cast<char>(c);
-                }
-        }
-    }
-    return oss.str();
-}
-
-// Base64 encoding helper (simplified)
-static std::string base64_encode(const std::vector<uint8_t>& data) {
-    static const char* base64_chars = 
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz"
-        "0123456789+/";
-    
-    std::string ret;
-    int i = 0;
-    int j = 0;
-    uint8_t char_array_3[3];
-    uint8_t char_array_4[4];
-    size_t in_len = data.size();
-    const uint8_t* bytes_to_encode = data.data();
-    
-    while (in_len--) {
-        char_array_3[i++] = *(bytes_to_encode++);
-        if (i == 3) {
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
-            
-            for(i = 0; i < 4; i++)
-                ret += base64_chars[char_array_4[i]];
-            i = 0;
-        }
-    }
-    
-    if (i) {
-        for(j = i; j < 3; j++)
-            char_array_3[j] = '\0';
-        
-        char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-        char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-        char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-        
-        for (j = 0; j < i + 1; j++)
-            ret += base64_chars[char_array_4[j]];
-        
-        while((i++ < 3))
-            ret += '=';
-    }
-    
-    return ret;
+// Part implementation
+std::string Part::to_json() const {
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
 }
 
 // TextPart implementation
-std::string TextPart::to_json() const {
-    std::ostringstream oss;
-    oss << "{"
-        << "\"kind\":\"text\","
-        << "\"text\":\"" << escape_json_string(text_) << "\""
-        << "}";
-    return oss.str();
+void TextPart::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("kind", "text");
+    writer.string_field("text", text_);
+    writer.end_object();
 }
 
 // FilePart implementation
-std::string FilePart::to_json() const {
-    std::ostringstream oss;
-    oss << "{"
-        << "\"kind\":\"file\","
-        << "\"file\":{"
-        << "\"filename\":\"" << filename_ << "\","
-        << "\"mimeType\":\"" << mime_type_ << "\","
-        << "\"data\":\"" << base64_encode(data_) << "\""
-        << "}}";
-    return oss.str();
+void FilePart::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("kind", "file");
+    writer.key("file");
+    writer.begin_object();
+    writer.string_field("filename", filename_);
+    writer.string_field("mimeType", mime_type_);
+    writer.key("data");
+    writer.bytes(data_.data(), data_.size());
+    writer.end_object();
+    writer.end_object();
 }
 
 // DataPart implementation
-std::string DataPart::to_json() const {
-    std::ostringstream oss;
-    oss << "{"
-        << "\"kind\":\"data\","
-        << "\"data\":" << data_json_
-        << "}";
-    return oss.str();
+void DataPart::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("kind", "data");
+    writer.json_text_field("data", data_json_);
+    writer.end_object();
 }
 
-// Part factory method
-std::unique_ptr<Part> Part::from_json(const std::string& json) {
-    // Simplified parsing - in production use nlohmann/json
+// Every part is preceded by a header naming the resource it came from
+namespace {
+
+struct alignas(std::max_align_t) PartHeader {
+    std::pmr::memory_resource* resource;
+    std::size_t size;
+};
+
+} // namespace
+
+void* Part::operator new(std::size_t size) {
+    return operator new(size, nullptr);
+}
+
+void* Part::operator new(std::size_t size, std::pmr::memory_resource* resource) {
+    if (!resource) {
+        resource = std::pmr::get_default_resource();
+    }
+    
+    std::size_t total = sizeof(PartHeader) + size;
+    void* block = resource->allocate(total, alignof(PartHeader));
+    auto* header = ::new (block) PartHeader{resource, total};
+    return header + 1;
+}
+
+void Part::operator delete(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
     
-    // Determine kind
-    size_t kind_pos = json.find("\"kind\":");
-    if (kind_pos == std::string::npos) {
+    auto* header = static_cast<PartHeader*>(ptr) - 1;
+    header->resource->deallocate(header, header->size, alignof(PartHeader));
+}
+
+void Part::operator delete(void* ptr, std::pmr::memory_resource*) noexcept {
+    operator delete(ptr);
+}
+
+// Part factory method
+std::unique_ptr<Part> Part::read_json(JsonReader& reader, std::pmr::memory_resource* resource) {
+    auto part = MessagePart::read_json(reader);
+    if (!part.has_value()) {
         return nullptr;
     }
     
-    size_t kind_start = json.find("\"", kind_pos + 7) + 1;
-    size_t kind_end = json.find("\"", kind_start);
-    std::string kind = json.substr(kind_start, kind_end - kind_start);
+    return part->visit([resource](auto& value) -> std::unique_ptr<Part> {
+        using T = std::decay_t<decltype(value)>;
+        return make<T>(resource, std::move(value));
+    });
+}
+
+std::optional<MessagePart> MessagePart::read_json(JsonReader& reader) {
+    // Members may arrive in any order, so collect them before
+    // deciding which concrete part to build.
+    std::optional<PartKind> kind;
+    std::string text;
+    std::string_view data;
+    std::string filename;
+    std::string mime_type;
+    std::vector<uint8_t> bytes;
     
-    if (kind == "text") {
-        size_t text_pos = json.find("\"text\":");
-        if (text_pos != std::string::npos) {
-            size_t text_start = json.find("\"", text_pos + 7) + 1;
-            size_t text_end = json.find("\"", text_start);
-            std::string text = json.substr(text_start, text_end - text_start);
-            return std::make_unique<TextPart>(text);
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
         }
-    } else if (kind == "file") {
-        // Simplified file parsing
-        return std::make_unique<FilePart>("file.dat", "application/octet-stream", std::vector<uint8_t>());
-    } else if (kind == "data") {
-        size_t data_pos = json.find("\"data\":");
-        if (data_pos != std::string::npos) {
-            size_t data_start = data_pos + 7;
-            size_t brace_count = 0;
-            size_t data_end = data_start;
-            
-            for (size_t i = data_start; i < json.length(); ++i) {
-                if (json[i] == '{' || json[i] == '[') brace_count++;
-                else if (json[i] == '}' || json[i] == ']') {
-                    if (brace_count > 0) brace_count--;
-                    else {
-                        data_end = i;
-                        break;
-                    }
+        
+        if (key == "kind") {
+            kind = part_kind_from_string(reader.read_string_view());
+        } else if (key == "text") {
+            text = reader.read_string();
+        } else if (key == "data") {
+            data = reader.read_json_text();
+        } else if (key == "file") {
+            reader.begin_object();
+            std::string_view file_key;
+            while (reader.next_key(file_key)) {
+                if (reader.consume_null()) {
+                    continue;
+                }
+                
+                if (file_key == "filename" || file_key == "name") {
+                    filename = reader.read_string();
+                } else if (file_key == "mimeType") {
+                    mime_type = reader.read_string();
+                } else if (file_key == "data" || file_key == "bytes") {
+                    bytes = reader.read_bytes();
+                } else {
+                    reader.skip_value();
                 }
             }
-            
-            std::string data = json.substr(data_start, data_end - data_start);
-            return std::make_unique<DataPart>(data);
+        } else {
+            reader.skip_value();
         }
     }
     
-    return nullptr;
+    if (kind == PartKind::Text) {
+        return MessagePart(TextPart(std::move(text)));
+    } else if (kind == PartKind::File) {
+        return MessagePart(FilePart(std::move(filename), std::move(mime_type),
+                                    std::move(bytes)));
+    } else if (kind == PartKind::Data) {
+        return MessagePart(DataPart(std::string(data)));
+    }
+    
+    return std::nullopt;
+}
+
+std::unique_ptr<Part> Part::from_json(std::string_view json, std::pmr::memory_resource* resource) {
+    JsonReader reader(json);
+    return read_json(reader, resource);
 }
 
 } // namespace a2a
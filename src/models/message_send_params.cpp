@@ -1,80 +1,109 @@
 #include <a2a/models/message_send_params.hpp>
-#include <sstream>
 
 namespace a2a {
 
 // MessageSendParams implementation
 std::string MessageSendParams::to_json() const {
-    std::ostringstream oss;
-    oss << "{";
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void MessageSendParams::write_json(JsonWriter& writer) const {
+    writer.begin_object();
     
     // Required field
-    oss << "\"message\":" << message_.to_json();
+    writer.key("message");
+    message_.write_json(writer);
     
     // Optional fields
     if (history_length_.has_value()) {
-        oss << ",\"historyLength\":" << *history_length_;
+        writer.integer_field("historyLength", *history_length_);
     }
     
     if (context_id_.has_value()) {
-        oss << ",\"contextId\":\"" << *context_id_ << "\"";
+        writer.string_field("contextId", *context_id_);
     }
     
     if (task_id_.has_value()) {
-        oss << ",\"taskId\":\"" << *task_id_ << "\"";
+        writer.string_field("taskId", *task_id_);
     }
     
-    oss << "}";
-    return oss.str();
+    writer.end_object();
 }
 
-MessageSendParams MessageSendParams::from_json(const std::string& json) {
-    MessageSendParams params;
-    
-    // Extract message
-    size_t msg_pos = json.find("\"message\":");
-    if (msg_pos != std::string::npos) {
-        size_t start = msg_pos + 10;
-        size_t brace_count = 0;
-        size_t end = start;
-        
-        for (size_t i = start; i < json.length(); ++i) {
-            if (json[i] == '{') brace_count++;
-            else if (json[i] == '}') {
-                brace_count--;
-                if (brace_count == 0) {
-                    end = i + 1;
-                    break;
-                }
-            }
+MessageSendParams MessageSendParams::from_json(std::string_view json,
+                                               std::pmr::memory_resource* resource) {
+    JsonReader reader(json);
+    return read_json(reader, resource);
+}
+
+MessageSendParams MessageSendParams::read_json(JsonReader& reader,
+                                               std::pmr::memory_resource* resource) {
+    // Moved in rather than assigned, so the message keeps the resource
+    MessageSendParams params{AgentMessage(resource)};
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
         }
         
-        std::string msg_json = json.substr(start, end - start);
-        params.message_ = AgentMessage::from_json(msg_json);
+        if (key == "message") {
+            params.message_ = AgentMessage::read_json(reader, resource);
+        } else if (key == "historyLength") {
+            params.history_length_ = static_cast<int>(reader.read_int());
+        } else if (key == "contextId") {
+            params.context_id_ = reader.read_string();
+        } else if (key == "taskId") {
+            params.task_id_ = reader.read_string();
+        } else {
+            reader.skip_value();
+        }
     }
     
-    // Extract historyLength (optional)
-    size_t hist_pos = json.find("\"historyLength\":");
-    if (hist_pos != std::string::npos) {
-        size_t start = hist_pos + 16;
-        size_t end = json.find_first_of(",}", start);
-        params.history_length_ = std::stoi(json.substr(start, end - start));
+    return params;
+}
+
+// MessageSendParamsView implementation
+MessageSendParams MessageSendParamsView::to_params(std::pmr::memory_resource* resource) const {
+    MessageSendParams params(message_.to_message(resource));
+    if (history_length_.has_value()) {
+        params.set_history_length(*history_length_);
     }
-    
-    // Extract contextId (optional)
-    size_t ctx_pos = json.find("\"contextId\":");
-    if (ctx_pos != std::string::npos) {
-        size_t start = json.find("\"", ctx_pos + 12) + 1;
-        size_t end = json.find("\"", start);
-        params.context_id_ = json.substr(start, end - start);
+    if (context_id_.has_value()) {
+        params.set_context_id(*context_id_);
     }
-    
-    // Extract taskId (optional)
-    size_t task_pos = json.find("\"taskId\":");
-    if (task_pos != std::string::npos) {
-        size_t start = json.find("\"", task_pos + 9) + 1;
-        size_t end = json.find("\"", start);
-        params.task_id_ = json.substr(start, end - start);
+    if (task_id_.has_value()) {
+        params.set_task_id(*task_id_);
+    }
+    return params;
+}
+
+MessageSendParamsView MessageSendParamsView::parse(std::string_view data, WireFormat format) {
+    JsonReader reader(data, format);
+    MessageSendParamsView params;
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "message") {
+            params.message_ = AgentMessageView::read_json(reader);
+        } else if (key == "historyLength") {
+            params.history_length_ = static_cast<int>(reader.read_int());
+        } else if (key == "contextId") {
+            params.context_id_ = reader.read_string();
+        } else if (key == "taskId") {
+            params.task_id_ = reader.read_string();
+        } else {
+            reader.skip_value();
+        }
     }
     
     return params;
@@ -82,47 +111,53 @@ MessageSendParams MessageSendParams::from_json(const std::string& json) {
 
 // TaskQueryParams implementation
 std::string TaskQueryParams::to_json() const {
-    std::ostringstream oss;
-    oss << "{";
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void TaskQueryParams::write_json(JsonWriter& writer) const {
+    writer.begin_object();
     
-    oss << "\"id\":\"" << id << "\"";
+    writer.string_field("id", id);
     
     if (history_length.has_value()) {
-        oss << ",\"historyLength\":" << *history_length;
+        writer.integer_field("historyLength", *history_length);
     }
     
     if (!metadata.empty()) {
-        oss << ",\"metadata\":{";
-        bool first = true;
-        for (const auto& [key, value] : metadata) {
-            if (!first) oss << ",";
-            oss << "\"" << key << "\":\"" << value << "\"";
-            first = false;
-        }
-        oss << "}";
+        writer.key("metadata");
+        writer.string_map(metadata);
     }
     
-    oss << "}";
-    return oss.str();
+    writer.end_object();
 }
 
-TaskQueryParams TaskQueryParams::from_json(const std::string& json) {
+TaskQueryParams TaskQueryParams::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
+}
+
+TaskQueryParams TaskQueryParams::read_json(JsonReader& reader) {
     TaskQueryParams params;
     
-    // Extract id
-    size_t id_pos = json.find("\"id\":");
-    if (id_pos != std::string::npos) {
-        size_t start = json.find("\"", id_pos + 5) + 1;
-        size_t end = json.find("\"", start);
-        params.id = json.substr(start, end - start);
-    }
-    
-    // Extract historyLength (optional)
-    size_t hist_pos = json.find("\"historyLength\":");
-    if (hist_pos != std::string::npos) {
-        size_t start = hist_pos + 16;
-        size_t end = json.find_first_of(",}", start);
-        params.history_length = std::stoi(json.substr(start, end - start));
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "id") {
+            params.id = reader.read_string();
+        } else if (key == "historyLength") {
+            params.history_length = static_cast<int>(reader.read_int());
+        } else if (key == "metadata") {
+            reader.read_string_map(params.metadata);
+        } else {
+            reader.skip_value();
+        }
     }
     
     return params;
@@ -130,20 +165,38 @@ TaskQueryParams TaskQueryParams::from_json(const std::string& json) {
 
 // TaskIdParams implementation
 std::string TaskIdParams::to_json() const {
-    std::ostringstream oss;
-    oss << "{\"id\":\"" << id << "\"}";
-    return oss.str();
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
 }
 
-TaskIdParams TaskIdParams::from_json(const std::string& json) {
+void TaskIdParams::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("id", id);
+    writer.end_object();
+}
+
+TaskIdParams TaskIdParams::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
+}
+
+TaskIdParams TaskIdParams::read_json(JsonReader& reader) {
     TaskIdParams params;
     
-    // Extract id
-    size_t id_pos = json.find("\"id\":");
-    if (id_pos != std::string::npos) {
-        size_t start = json.find("\"", id_pos + 5) + 1;
-        size_t end = json.find("\"", start);
-        params.id = json.substr(start, end - start);
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "id") {
+            params.id = reader.read_string();
+        } else {
+            reader.skip_value();
+        }
     }
     
     return params;
@@ -0,0 +1,39 @@
+#include <a2a/models/stream_event.hpp>
+#include <a2a/core/json_reader.hpp>
+
+namespace a2a {
+
+StreamEvent StreamEvent::from_json(std::string_view json) {
+    std::string_view kind;
+    bool has_status = false;
+    bool has_role = false;
+    
+    JsonReader reader(json);
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "kind" && reader.peek() == JsonReader::Type::String) {
+            kind = reader.read_string_view();
+            break;
+        }
+        if (key == "status") {
+            has_status = true;
+        } else if (key == "role") {
+            has_role = true;
+        }
+        reader.skip_value();
+    }
+    
+    if (kind == "status-update") {
+        return TaskStatusUpdateEvent::from_json(json);
+    }
+    if (kind == "artifact-update") {
+        return TaskArtifactUpdateEvent::from_json(json);
+    }
+    if (kind == "message" || (kind.empty() && has_role && !has_status)) {
+        return AgentMessage::from_json(json);
+    }
+    return AgentTask::from_json(json);
+}
+
+} // namespace a2a
@@ -0,0 +1,108 @@
+#include <a2a/models/task_events.hpp>
+
+namespace a2a {
+
+// TaskStatusUpdateEvent implementation
+std::string TaskStatusUpdateEvent::to_json() const {
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void TaskStatusUpdateEvent::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("kind", "status-update");
+    writer.string_field("taskId", task_id_);
+    writer.string_field("contextId", context_id_);
+    writer.key("status");
+    status_.write_json(writer);
+    writer.bool_field("final", final_);
+    writer.end_object();
+}
+
+TaskStatusUpdateEvent TaskStatusUpdateEvent::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
+}
+
+TaskStatusUpdateEvent TaskStatusUpdateEvent::read_json(JsonReader& reader) {
+    TaskStatusUpdateEvent event;
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "taskId") {
+            event.task_id_ = reader.read_string();
+        } else if (key == "contextId") {
+            event.context_id_ = reader.read_string();
+        } else if (key == "status") {
+            event.status_ = AgentTaskStatus::read_json(reader);
+        } else if (key == "final") {
+            event.final_ = reader.read_bool();
+        } else {
+            reader.skip_value();
+        }
+    }
+    
+    return event;
+}
+
+// TaskArtifactUpdateEvent implementation
+std::string TaskArtifactUpdateEvent::to_json() const {
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void TaskArtifactUpdateEvent::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("kind", "artifact-update");
+    writer.string_field("taskId", task_id_);
+    writer.string_field("contextId", context_id_);
+    writer.key("artifact");
+    artifact_.write_json(writer);
+    writer.bool_field("append", append_);
+    writer.bool_field("lastChunk", last_chunk_);
+    writer.end_object();
+}
+
+TaskArtifactUpdateEvent TaskArtifactUpdateEvent::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
+}
+
+TaskArtifactUpdateEvent TaskArtifactUpdateEvent::read_json(JsonReader& reader) {
+    TaskArtifactUpdateEvent event;
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "taskId") {
+            event.task_id_ = reader.read_string();
+        } else if (key == "contextId") {
+            event.context_id_ = reader.read_string();
+        } else if (key == "artifact") {
+            event.artifact_ = Artifact::read_json(reader);
+        } else if (key == "append") {
+            event.append_ = reader.read_bool();
+        } else if (key == "lastChunk") {
+            event.last_chunk_ = reader.read_bool();
+        } else {
+            reader.skip_value();
+        }
+    }
+    
+    return event;
+}
+
+} // namespace a2a
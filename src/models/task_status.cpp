@@ -1,12 +1,21 @@
 #include <a2a/models/task_status.hpp>
-#include <sstream>
-#include <iomanip>
+#include <cstdio>
 #include <ctime>
 
 namespace a2a {
 
+// Days since 1970-01-01 for a proleptic Gregorian civil date
+static int64_t days_from_civil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
 // Helper to convert timestamp to ISO 8601 string
-static std::string timestamp_to_iso8601(const Timestamp& ts) {
+static void write_iso8601(JsonWriter& writer, const Timestamp& ts) {
     auto time_t_val = std::chrono::system_clock::to_time_t(ts);
     std::tm tm_val;
     
@@ -16,54 +25,100 @@ static std::string timestamp_to_iso8601(const Timestamp& ts) {
     gmtime_r(&time_t_val, &tm_val);
 #endif
     
-    std::ostringstream oss;
-    oss << std::put_time(&tm_val, "%Y-%m-%dT%H:%M:%S");
-    
     // Add milliseconds
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         ts.time_since_epoch()
     ) % 1000;
     
-    oss << "." << std::setfill('0') << std::setw(3) << ms.count() << "Z";
+    char buf[32];
+    int len = std::snprintf(buf, sizeof(buf), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ",
+                            tm_val.tm_year + 1900, tm_val.tm_mon + 1, tm_val.tm_mday,
+                            tm_val.tm_hour, tm_val.tm_min, tm_val.tm_sec,
+                            static_cast<int>(ms.count()));
+    writer.string(std::string_view(buf, static_cast<size_t>(len)));
+}
+
+// Parse "YYYY-MM-DDTHH:MM:SS[.fff]Z"; falls back to now() on malformed input
+static Timestamp parse_iso8601(std::string_view str) {
+    auto digits = [&](size_t pos, size_t count, int& out) {
+        if (pos + count > str.size()) return false;
+        out = 0;
+        for (size_t i = pos; i < pos + count; ++i) {
+            if (str[i] < '0' || str[i] > '9') return false;
+            out = out * 10 + (str[i] - '0');
+        }
+        return true;
+    };
+    
+    int year, month, day, hour, minute, second;
+    if (!digits(0, 4, year) || !digits(5, 2, month) || !digits(8, 2, day) ||
+        !digits(11, 2, hour) || !digits(14, 2, minute) || !digits(17, 2, second) ||
+        month < 1 || month > 12 || day < 1 || day > 31) {
+        return std::chrono::system_clock::now();
+    }
+    
+    int millis = 0;
+    if (str.size() > 19 && str[19] == '.') {
+        int scale = 100;
+        for (size_t i = 20; i < str.size() && str[i] >= '0' && str[i] <= '9'; ++i) {
+            millis += (str[i] - '0') * scale;
+            scale /= 10;
+        }
+    }
     
-    return oss.str();
+    int64_t seconds = days_from_civil(year, static_cast<unsigned>(month),
+                                      static_cast<unsigned>(day)) * 86400 +
+                      hour * 3600 + minute * 60 + second;
+    
+    return Timestamp(std::chrono::duration_cast<Timestamp::duration>(
+        std::chrono::seconds(seconds) + std::chrono::milliseconds(millis)
+    ));
 }
 
 std::string AgentTaskStatus::to_json() const {
-    std::ostringstream oss;
-    oss << "{"
-        << "\"state\":\"" << to_string(state_) << "\","
-        << "\"timestamp\":\"" << timestamp_to_iso8601(timestamp_) << "\"";
+    std::string out;
+    JsonWriter writer(out);
+    write_json(writer);
+    return out;
+}
+
+void AgentTaskStatus::write_json(JsonWriter& writer) const {
+    writer.begin_object();
+    writer.string_field("state", to_string(state_));
+    writer.key("timestamp");
+    write_iso8601(writer, timestamp_);
     
     if (!message_.empty()) {
-        oss << ",\"message\":\"" << message_ << "\"";
+        writer.string_field("message", message_);
     }
     
-    oss << "}";
-    return oss.str();
+    writer.end_object();
+}
+
+AgentTaskStatus AgentTaskStatus::from_json(std::string_view json) {
+    JsonReader reader(json);
+    return read_json(reader);
 }
 
-AgentTaskStatus AgentTaskStatus::from_json(const std::string& json) {
+AgentTaskStatus AgentTaskStatus::read_json(JsonReader& reader) {
     AgentTaskStatus status;
     
-    // Extract state
-    size_t state_pos = json.find("\"state\":");
-    if (state_pos != std::string::npos) {
-        size_t start = json.find("\"", state_pos + 8) + 1;
-        size_t end = json.find("\"", start);
-        std::string state_str = json.substr(start, end - start);
-        status.state_ = task_state_from_string(state_str);
-    }
-    
-    // Extract timestamp (simplified - just use current time)
-    status.timestamp_ = std::chrono::system_clock::now();
-    
-    // Extract message (optional)
-    size_t msg_pos = json.find("\"message\":");
-    if (msg_pos != std::string::npos) {
-        size_t start = json.find("\"", msg_pos + 10) + 1;
-        size_t end = json.find("\"", start);
-        status.message_ = json.substr(start, end - start);
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (reader.consume_null()) {
+            continue;
+        }
+        
+        if (key == "state") {
+            status.state_ = task_state_from_string(reader.read_string_view());
+        } else if (key == "timestamp") {
+            status.timestamp_ = parse_iso8601(reader.read_string_view());
+        } else if (key == "message" && reader.peek() == JsonReader::Type::String) {
+            status.message_ = reader.read_string();
+        } else {
+            reader.skip_value();
+        }
     }
     
     return status;
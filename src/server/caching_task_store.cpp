@@ -0,0 +1,344 @@
+#include <a2a/server/caching_task_store.hpp>
+#include <a2a/core/exception.hpp>
+#include "task_size.hpp"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace a2a {
+
+using server::approximate_size;
+
+// PIMPL implementation
+class CachingTaskStore::Impl {
+public:
+    using Clock = std::chrono::steady_clock;
+    
+    Impl(std::shared_ptr<ITaskStore> store, const CachingTaskStoreOptions& options)
+        : store_(std::move(store))
+        , options_(options) {
+        if (!store_) {
+            throw A2AException("CachingTaskStore requires a backing store", ErrorCode::InvalidParams);
+        }
+    }
+    
+    /**
+     * @brief Snapshot of a task, from the cache or else the backing store
+     */
+    std::shared_ptr<const AgentTask> get(const std::string& task_id) {
+        uint64_t generation;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(task_id);
+            if (it != index_.end()) {
+                if (!expired(*it->second)) {
+                    lru_.splice(lru_.begin(), lru_, it->second);
+                    return it->second->task;
+                }
+                erase(it);
+            }
+            generation = generations_[stripe(task_id)];
+        }
+        
+        // Loaded without the lock, so other tasks stay available meanwhile
+        auto loaded = store_->get_task(task_id);
+        if (!loaded.has_value()) {
+            return nullptr;
+        }
+        auto task = std::make_shared<AgentTask>(std::move(*loaded));
+        if (options_.max_history != 0) {
+            task->set_history_capacity(options_.max_history);
+        }
+        size_t bytes = approximate_size(*task);
+        
+        std::lock_guard<std::mutex> lock(mutex_);
+        // A write or invalidation since the load began may be missing from it
+        if (generations_[stripe(task_id)] == generation) {
+            auto it = index_.find(task_id);
+            if (it != index_.end()) {
+                erase(it);
+            }
+            insert(task_id, task, bytes);
+        }
+        return task;
+    }
+    
+    /**
+     * @brief Apply a write to the backing store, then to the cached copy
+     * @param apply Updates the cached task and its size in bytes
+     */
+    void write(const std::string& task_id,
+               const std::function<void()>& write_store,
+               const std::function<void(AgentTask&, size_t&)>& apply) {
+        // Writes to one task reach the cache in the order they reached the store
+        std::lock_guard<std::mutex> write_lock(write_locks_[stripe(task_id)]);
+        try {
+            write_store();
+        } catch (...) {
+            // The write may or may not have been applied
+            invalidate(task_id);
+            throw;
+        }
+        
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generations_[stripe(task_id)];
+        auto it = index_.find(task_id);
+        if (it == index_.end()) {
+            return;
+        }
+        
+        Entry& entry = *it->second;
+        size_t bytes = entry.bytes;
+        apply(writable(entry.task), bytes);
+        bytes_ = bytes_ - entry.bytes + bytes;
+        entry.bytes = bytes;
+        evict();
+    }
+    
+    /**
+     * @brief Store a new version of a task in the backing store and the cache
+     */
+    void put(const AgentTask& task) {
+        auto copy = std::make_shared<AgentTask>(task);
+        if (options_.max_history != 0) {
+            copy->set_history_capacity(options_.max_history);
+        }
+        size_t bytes = approximate_size(*copy);
+        
+        std::lock_guard<std::mutex> write_lock(write_locks_[stripe(task.id())]);
+        try {
+            store_->set_task(task);
+        } catch (...) {
+            invalidate(task.id());
+            throw;
+        }
+        
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generations_[stripe(task.id())];
+        auto it = index_.find(task.id());
+        if (it != index_.end()) {
+            erase(it);
+        }
+        insert(task.id(), std::move(copy), bytes);
+    }
+    
+    bool cached(const std::string& task_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(task_id);
+        return it != index_.end() && !expired(*it->second);
+    }
+    
+    void invalidate(const std::string& task_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generations_[stripe(task_id)];
+        auto it = index_.find(task_id);
+        if (it != index_.end()) {
+            erase(it);
+        }
+    }
+    
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& generation : generations_) {
+            ++generation;
+        }
+        index_.clear();
+        lru_.clear();
+        bytes_ = 0;
+    }
+    
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return index_.size();
+    }
+    
+    size_t bytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return bytes_;
+    }
+    
+    std::shared_ptr<ITaskStore> store_;
+    CachingTaskStoreOptions options_;
+
+private:
+    struct Entry {
+        std::string id;
+        std::shared_ptr<AgentTask> task;
+        size_t bytes;
+        Clock::time_point loaded;
+    };
+    
+    using Lru = std::list<Entry>;
+    
+    static constexpr size_t STRIPES = 64;
+    
+    static size_t stripe(const std::string& task_id) {
+        return std::hash<std::string>{}(task_id) % STRIPES;
+    }
+    
+    // Task to modify in place, detached first from any outstanding snapshot
+    static AgentTask& writable(std::shared_ptr<AgentTask>& task) {
+        if (task.use_count() > 1) {
+            task = std::make_shared<AgentTask>(*task);
+        } else {
+            // use_count() is a relaxed load: order the last reader's accesses
+            // before our writes
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *task;
+    }
+    
+    bool expired(const Entry& entry) const {
+        return options_.ttl.count() > 0 && Clock::now() - entry.loaded >= options_.ttl;
+    }
+    
+    void insert(const std::string& task_id, std::shared_ptr<AgentTask> task, size_t bytes) {
+        if (bytes > options_.max_bytes) {
+            return;
+        }
+        lru_.push_front({task_id, std::move(task), bytes, Clock::now()});
+        index_.emplace(task_id, lru_.begin());
+        bytes_ += bytes;
+        evict();
+    }
+    
+    void erase(std::unordered_map<std::string, Lru::iterator>::iterator it) {
+        bytes_ -= it->second->bytes;
+        lru_.erase(it->second);
+        index_.erase(it);
+    }
+    
+    // Drop least recently used tasks until within budget
+    void evict() {
+        while (bytes_ > options_.max_bytes && !lru_.empty()) {
+            erase(index_.find(lru_.back().id));
+        }
+    }
+    
+    mutable std::mutex mutex_;
+    Lru lru_;  ///< Most recently used first
+    std::unordered_map<std::string, Lru::iterator> index_;
+    size_t bytes_ = 0;
+    std::array<uint64_t, STRIPES> generations_{};  ///< Bumped by every change to a stripe's tasks
+    
+    std::array<std::mutex, STRIPES> write_locks_;
+};
+
+CachingTaskStore::CachingTaskStore(std::shared_ptr<ITaskStore> store,
+                                   const CachingTaskStoreOptions& options)
+    : impl_(std::make_unique<Impl>(std::move(store), options)) {}
+
+CachingTaskStore::~CachingTaskStore() = default;
+
+std::optional<AgentTask> CachingTaskStore::get_task(const std::string& task_id) {
+    auto task = impl_->get(task_id);
+    if (!task) {
+        return std::nullopt;
+    }
+    return *task;
+}
+
+std::shared_ptr<const AgentTask> CachingTaskStore::get_task_snapshot(const std::string& task_id) {
+    return impl_->get(task_id);
+}
+
+void CachingTaskStore::set_task(const AgentTask& task) {
+    impl_->put(task);
+}
+
+void CachingTaskStore::update_status(const std::string& task_id,
+                                     TaskState status,
+                                     const std::string& message) {
+    AgentTaskStatus new_status(status);
+    if (!message.empty()) {
+        new_status.set_message(message);
+    }
+    
+    impl_->write(task_id,
+                 [&] { impl_->store_->update_status(task_id, status, message); },
+                 [&](AgentTask& task, size_t& bytes) {
+                     bytes = bytes - task.status().message().size() + new_status.message().size();
+                     task.set_status(new_status);
+                 });
+}
+
+void CachingTaskStore::add_artifact(const std::string& task_id,
+                                    const Artifact& artifact) {
+    impl_->write(task_id,
+                 [&] { impl_->store_->add_artifact(task_id, artifact); },
+                 [&](AgentTask& task, size_t& bytes) {
+                     task.add_artifact(artifact);
+                     bytes += approximate_size(artifact);
+                 });
+}
+
+void CachingTaskStore::add_history_message(const std::string& task_id,
+                                           const AgentMessage& message) {
+    impl_->write(task_id,
+                 [&] { impl_->store_->add_history_message(task_id, message); },
+                 [&](AgentTask& task, size_t& bytes) {
+                     const MessageHistory& history = task.history();
+                     if (history.capacity() != 0 && history.size() == history.capacity()) {
+                         // The oldest message makes room
+                         bytes -= approximate_size(history.front());
+                     }
+                     task.add_history_message(message);
+                     bytes += approximate_size(message);
+                 });
+}
+
+std::vector<AgentMessage> CachingTaskStore::get_history(const std::string& context_id,
+                                                        int max_length) {
+    std::vector<AgentMessage> history;
+    for (const auto& message : get_history_tail(context_id, max_length > 0 ? max_length : 0)) {
+        history.push_back(*message);
+    }
+    return history;
+}
+
+std::vector<std::shared_ptr<const AgentMessage>> CachingTaskStore::get_history_tail(const std::string& context_id,
+                                                                                    size_t max_length) {
+    auto task = impl_->get(context_id);
+    if (!task) {
+        return {};
+    }
+    return task->history().tail(max_length);
+}
+
+bool CachingTaskStore::delete_task(const std::string& task_id) {
+    bool deleted = false;
+    impl_->write(task_id,
+                 [&] { deleted = impl_->store_->delete_task(task_id); },
+                 [](AgentTask&, size_t&) {});
+    impl_->invalidate(task_id);
+    return deleted;
+}
+
+bool CachingTaskStore::task_exists(const std::string& task_id) {
+    return impl_->cached(task_id) || impl_->store_->task_exists(task_id);
+}
+
+void CachingTaskStore::invalidate(const std::string& task_id) {
+    impl_->invalidate(task_id);
+}
+
+void CachingTaskStore::clear() {
+    impl_->clear();
+}
+
+ITaskStore& CachingTaskStore::store() const {
+    return *impl_->store_;
+}
+
+size_t CachingTaskStore::size() const {
+    return impl_->size();
+}
+
+size_t CachingTaskStore::bytes() const {
+    return impl_->bytes();
+}
+
+} // namespace a2a
@@ -0,0 +1,369 @@
+#include "http_parser.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace a2a {
+namespace server {
+
+namespace {
+
+std::string to_lower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+// Trim optional whitespace around a header value
+std::string trim(const std::string& value, size_t begin, size_t end) {
+    while (begin < end && (value[begin] == ' ' || value[begin] == '\t')) {
+        ++begin;
+    }
+    while (end > begin && (value[end - 1] == ' ' || value[end - 1] == '\t')) {
+        --end;
+    }
+    return value.substr(begin, end - begin);
+}
+
+bool contains_token(const std::string& list, const char* token) {
+    return to_lower(list).find(token) != std::string::npos;
+}
+
+} // namespace
+
+const std::string& HttpRequest::header(const std::string& name) const {
+    static const std::string empty;
+    auto it = headers.find(name);
+    return it != headers.end() ? it->second : empty;
+}
+
+bool HttpRequest::keep_alive() const {
+    const std::string& connection = header("connection");
+    if (version == "HTTP/1.0") {
+        return contains_token(connection, "keep-alive");
+    }
+    return !contains_token(connection, "close");
+}
+
+void HttpRequestParser::reset() {
+    state_ = State::Headers;
+    request_ = HttpRequest();
+    head_.clear();
+    line_.clear();
+    remaining_ = 0;
+    error_status_ = 0;
+    continue_pending_ = false;
+}
+
+HttpRequestParser::Status HttpRequestParser::fail(int status) {
+    error_status_ = status;
+    return Status::Error;
+}
+
+bool HttpRequestParser::read_line(const char*& p, const char* end) {
+    const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+    if (!newline) {
+        line_.append(p, end);
+        p = end;
+        return false;
+    }
+    
+    line_.append(p, newline);
+    p = newline + 1;
+    if (!line_.empty() && line_.back() == '\r') {
+        line_.pop_back();
+    }
+    return true;
+}
+
+HttpRequestParser::Status HttpRequestParser::parse(const char* data, size_t size, size_t& consumed) {
+    const char* p = data;
+    const char* end = data + size;
+    
+    for (;;) {
+        if (state_ == State::Done) {
+            consumed = static_cast<size_t>(p - data);
+            return Status::Complete;
+        }
+        if (p == end) {
+            consumed = size;
+            return Status::Incomplete;
+        }
+        
+        switch (state_) {
+            case State::Headers: {
+                // Tolerate blank lines between pipelined requests
+                if (head_.empty()) {
+                    while (p < end && (*p == '\r' || *p == '\n')) {
+                        ++p;
+                    }
+                    if (p == end) {
+                        break;
+                    }
+                }
+                
+                // The head ends at the first blank line, "\r\n\r\n" or a bare
+                // "\n\n"; it may straddle reads, so look back into head_
+                auto before = [&](const char* at, size_t back) -> char {
+                    size_t offset = static_cast<size_t>(at - p);
+                    if (back <= offset) {
+                        return at[-static_cast<std::ptrdiff_t>(back)];
+                    }
+                    back -= offset;
+                    return back <= head_.size() ? head_[head_.size() - back] : '\0';
+                };
+                
+                const char* head_end = nullptr;
+                for (const char* q = p; q < end; ) {
+                    const char* newline = static_cast<const char*>(std::memchr(q, '\n', static_cast<size_t>(end - q)));
+                    if (!newline) {
+                        break;
+                    }
+                    char prev = before(newline, 1);
+                    if (prev == '\n' || (prev == '\r' && before(newline, 2) == '\n')) {
+                        head_end = newline + 1;
+                        break;
+                    }
+                    q = newline + 1;
+                }
+                
+                if (!head_end) {
+                    head_.append(p, end);
+                    p = end;
+                    if (head_.size() > max_header_bytes_) {
+                        return fail(431);
+                    }
+                    break;
+                }
+                
+                // Bytes past the blank line belong to the body or the next request
+                head_.append(p, head_end);
+                p = head_end;
+                for (int i = 0; i < 2; ++i) {
+                    head_.pop_back();
+                    if (!head_.empty() && head_.back() == '\r') {
+                        head_.pop_back();
+                    }
+                }
+                
+                if (head_.size() > max_header_bytes_) {
+                    return fail(431);
+                }
+                if (!parse_head()) {
+                    return Status::Error;
+                }
+                break;
+            }
+            
+            case State::Body: {
+                size_t n = std::min(remaining_, static_cast<size_t>(end - p));
+                request_.body.append(p, n);
+                p += n;
+                remaining_ -= n;
+                if (remaining_ == 0) {
+                    state_ = State::Done;
+                }
+                break;
+            }
+            
+            case State::ChunkSize: {
+                if (!read_line(p, end)) {
+                    if (line_.size() > max_header_bytes_) {
+                        return fail(400);
+                    }
+                    break;
+                }
+                
+                // Chunk extensions after ';' are ignored
+                size_t chunk_size = 0;
+                size_t digits = 0;
+                for (char c : line_) {
+                    int v;
+                    if (c >= '0' && c <= '9') v = c - '0';
+                    else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+                    else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+                    else break;
+                    if (chunk_size > (max_body_bytes_ >> 4)) {
+                        return fail(413);
+                    }
+                    chunk_size = (chunk_size << 4) | static_cast<size_t>(v);
+                    ++digits;
+                }
+                line_.clear();
+                
+                if (digits == 0) {
+                    return fail(400);
+                }
+                if (chunk_size == 0) {
+                    state_ = State::Trailers;
+                    break;
+                }
+                if (chunk_size > max_body_bytes_ - request_.body.size()) {
+                    return fail(413);
+                }
+                
+                remaining_ = chunk_size;
+                state_ = State::ChunkData;
+                break;
+            }
+            
+            case State::ChunkData: {
+                size_t n = std::min(remaining_, static_cast<size_t>(end - p));
+                request_.body.append(p, n);
+                p += n;
+                remaining_ -= n;
+                if (remaining_ == 0) {
+                    state_ = State::ChunkDataEnd;
+                }
+                break;
+            }
+            
+            case State::ChunkDataEnd: {
+                if (!read_line(p, end)) {
+                    if (line_.size() > 1) {
+                        return fail(400);
+                    }
+                    break;
+                }
+                if (!line_.empty()) {
+                    return fail(400);
+                }
+                state_ = State::ChunkSize;
+                break;
+            }
+            
+            case State::Trailers: {
+                if (!read_line(p, end)) {
+                    if (line_.size() > max_header_bytes_) {
+                        return fail(431);
+                    }
+                    break;
+                }
+                // Trailer fields are read past and dropped
+                bool last = line_.empty();
+                line_.clear();
+                if (last) {
+                    state_ = State::Done;
+                }
+                break;
+            }
+            
+            case State::Done:
+                break;
+        }
+    }
+}
+
+bool HttpRequestParser::parse_head() {
+    size_t line_end = head_.find('\n');
+    std::string request_line = head_.substr(0, line_end);
+    if (!request_line.empty() && request_line.back() == '\r') {
+        request_line.pop_back();
+    }
+    
+    // Request line: METHOD SP request-target SP HTTP-version
+    size_t sp1 = request_line.find(' ');
+    size_t sp2 = sp1 == std::string::npos ? sp1 : request_line.find(' ', sp1 + 1);
+    if (sp1 == std::string::npos || sp2 == std::string::npos || sp1 == 0 || sp2 == sp1 + 1) {
+        error_status_ = 400;
+        return false;
+    }
+    
+    request_.method = request_line.substr(0, sp1);
+    std::string target = request_line.substr(sp1 + 1, sp2 - sp1 - 1);
+    request_.version = request_line.substr(sp2 + 1);
+    
+    if (request_.version.compare(0, 7, "HTTP/1.") != 0) {
+        error_status_ = 505;
+        return false;
+    }
+    
+    size_t query_pos = target.find('?');
+    if (query_pos != std::string::npos) {
+        request_.query = target.substr(query_pos + 1);
+        target.resize(query_pos);
+    }
+    request_.path = std::move(target);
+    
+    // Header fields
+    size_t pos = line_end == std::string::npos ? head_.size() : line_end + 1;
+    while (pos < head_.size()) {
+        size_t next = head_.find('\n', pos);
+        if (next == std::string::npos) {
+            next = head_.size();
+        }
+        size_t stop = next;
+        if (stop > pos && head_[stop - 1] == '\r') {
+            --stop;
+        }
+        
+        // Obsolete line folding is not accepted
+        if (head_[pos] == ' ' || head_[pos] == '\t') {
+            error_status_ = 400;
+            return false;
+        }
+        
+        size_t colon = head_.find(':', pos);
+        if (colon == std::string::npos || colon >= stop || colon == pos) {
+            error_status_ = 400;
+            return false;
+        }
+        
+        std::string name = to_lower(head_.substr(pos, colon - pos));
+        std::string value = trim(head_, colon + 1, stop);
+        
+        auto [it, inserted] = request_.headers.emplace(std::move(name), value);
+        if (!inserted) {
+            it->second += ", " + value;
+        }
+        
+        pos = next + 1;
+    }
+    
+    // Body framing
+    const std::string& transfer_encoding = request_.header("transfer-encoding");
+    const std::string& content_length = request_.header("content-length");
+    
+    if (!transfer_encoding.empty()) {
+        // Both framings at once is the request-smuggling pattern (RFC 9112 6.1)
+        if (!content_length.empty()) {
+            error_status_ = 400;
+            return false;
+        }
+        if (to_lower(transfer_encoding) != "chunked") {
+            error_status_ = 501;
+            return false;
+        }
+        state_ = State::ChunkSize;
+    } else if (!content_length.empty()) {
+        size_t length = 0;
+        for (char c : content_length) {
+            if (c < '0' || c > '9') {
+                error_status_ = 400;
+                return false;
+            }
+            if (length > max_body_bytes_) {
+                break;
+            }
+            length = length * 10 + static_cast<size_t>(c - '0');
+        }
+        if (length > max_body_bytes_) {
+            error_status_ = 413;
+            return false;
+        }
+        remaining_ = length;
+        state_ = length > 0 ? State::Body : State::Done;
+        request_.body.reserve(length);
+    } else {
+        state_ = State::Done;
+    }
+    
+    if (state_ != State::Done && contains_token(request_.header("expect"), "100-continue")) {
+        continue_pending_ = true;
+    }
+    
+    return true;
+}
+
+} // namespace server
+} // namespace a2a
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <a2a/server/http_server.hpp>
+#include <string>
+#include <cstddef>
+
+namespace a2a {
+namespace server {
+
+/**
+ * @brief Incremental HTTP/1.x request parser
+ *
+ * Bytes are fed as they arrive from the socket; the parser keeps its
+ * position across calls, so a request split over any number of reads (or
+ * several requests in one read) is handled without re-scanning.
+ */
+class HttpRequestParser {
+public:
+    enum class Status {
+        Incomplete,
+        Complete,
+        Error
+    };
+    
+    HttpRequestParser(size_t max_header_bytes, size_t max_body_bytes)
+        : max_header_bytes_(max_header_bytes)
+        , max_body_bytes_(max_body_bytes) {}
+    
+    /**
+     * @brief Consume bytes until a request completes or input runs out
+     * @param consumed Set to the number of bytes used from data
+     */
+    Status parse(const char* data, size_t size, size_t& consumed);
+    
+    /**
+     * @brief The completed request (valid after Status::Complete)
+     */
+    HttpRequest& request() { return request_; }
+    
+    /**
+     * @brief HTTP status to answer with after Status::Error
+     */
+    int error_status() const { return error_status_; }
+    
+    /**
+     * @brief True once if the client sent "Expect: 100-continue"
+     */
+    bool take_continue() {
+        bool pending = continue_pending_;
+        continue_pending_ = false;
+        return pending;
+    }
+    
+    /**
+     * @brief Prepare for the next request on the same connection
+     */
+    void reset();
+
+private:
+    enum class State {
+        Headers,
+        Body,
+        ChunkSize,
+        ChunkData,
+        ChunkDataEnd,
+        Trailers,
+        Done
+    };
+    
+    Status fail(int status);
+    bool read_line(const char*& p, const char* end);
+    bool parse_head();
+    
+    size_t max_header_bytes_;
+    size_t max_body_bytes_;
+    
+    State state_ = State::Headers;
+    HttpRequest request_;
+    std::string head_;
+    std::string line_;
+    size_t remaining_ = 0;
+    int error_status_ = 0;
+    bool continue_pending_ = false;
+};
+
+} // namespace server
+} // namespace a2a
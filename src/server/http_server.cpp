@@ -0,0 +1,1259 @@
+#include <a2a/server/http_server.hpp>
+#include <a2a/server/jsonrpc_dispatcher.hpp>
+#include <a2a/server/task_manager.hpp>
+#include <a2a/core/json_writer.hpp>
+#include <a2a/core/compression.hpp>
+#include <a2a/core/exception.hpp>
+#include "http_parser.hpp"
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <netdb.h>
+#include <strings.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace a2a {
+namespace server {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint64_t kListenerTag = 0;
+constexpr uint64_t kWakeTag = 1;
+constexpr size_t kReadChunk = 64 * 1024;
+
+const char* reason_phrase(int status) {
+    switch (status) {
+        case 100: return "Continue";
+        case 200: return "OK";
+        case 201: return "Created";
+        case 202: return "Accepted";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 408: return "Request Timeout";
+        case 413: return "Payload Too Large";
+        case 415: return "Unsupported Media Type";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        case 503: return "Service Unavailable";
+        case 505: return "HTTP Version Not Supported";
+        default:  return "Unknown";
+    }
+}
+
+std::string error_body(const std::string& message) {
+    std::string body;
+    JsonWriter writer(body);
+    writer.begin_object();
+    writer.string_field("error", message);
+    writer.end_object();
+    return body;
+}
+
+// Serialize status line, headers and body into one buffer
+std::string serialize_response(const HttpResponse& response, bool keep_alive) {
+    std::string out;
+    out.reserve(128 + response.body.size());
+    
+    out.append("HTTP/1.1 ");
+    out.append(std::to_string(response.status_code));
+    out.push_back(' ');
+    out.append(reason_phrase(response.status_code));
+    out.append("\r\n");
+    
+    // 204 and 304 carry no body, so no Content-Length either (RFC 9110 8.6);
+    // 304 describes the cached representation
+    bool no_body = response.status_code == 204 || response.status_code == 304;
+    bool has_content_type = false;
+    for (const auto& [name, value] : response.headers) {
+        if (strcasecmp(name.c_str(), "content-length") == 0 ||
+            strcasecmp(name.c_str(), "connection") == 0) {
+            continue;
+        }
+        if (strcasecmp(name.c_str(), "content-type") == 0) {
+            has_content_type = true;
+        }
+        out.append(name).append(": ").append(value).append("\r\n");
+    }
+    if (no_body) {
+        out.append(keep_alive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
+        return out;
+    }
+    if (!has_content_type) {
+        out.append("Content-Type: application/json\r\n");
+    }
+    
+    out.append("Content-Length: ");
+    out.append(std::to_string(response.body.size()));
+    out.append(keep_alive ? "\r\nConnection: keep-alive\r\n\r\n" : "\r\nConnection: close\r\n\r\n");
+    out.append(response.body);
+    return out;
+}
+
+HttpResponse make_response(int status, std::string body) {
+    HttpResponse response;
+    response.status_code = status;
+    response.body = std::move(body);
+    return response;
+}
+
+// Status line and headers of a response whose length is not known up front
+std::string serialize_stream_head(int status, const std::map<std::string, std::string>& headers,
+                                  bool chunked, bool keep_alive) {
+    std::string out;
+    out.append("HTTP/1.1 ");
+    out.append(std::to_string(status));
+    out.push_back(' ');
+    out.append(reason_phrase(status));
+    out.append("\r\n");
+    
+    for (const auto& [name, value] : headers) {
+        if (strcasecmp(name.c_str(), "content-length") == 0 ||
+            strcasecmp(name.c_str(), "transfer-encoding") == 0 ||
+            strcasecmp(name.c_str(), "connection") == 0) {
+            continue;
+        }
+        out.append(name).append(": ").append(value).append("\r\n");
+    }
+    
+    if (chunked) {
+        out.append("Transfer-Encoding: chunked\r\n");
+    }
+    out.append(keep_alive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
+    return out;
+}
+
+bool has_header(const std::map<std::string, std::string>& headers, const char* name) {
+    for (const auto& entry : headers) {
+        if (strcasecmp(entry.first.c_str(), name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool is_event_stream(const std::map<std::string, std::string>& headers) {
+    for (const auto& [name, value] : headers) {
+        if (strcasecmp(name.c_str(), "content-type") == 0) {
+            return strncasecmp(value.c_str(), "text/event-stream", 17) == 0;
+        }
+    }
+    return false;
+}
+
+// serialize() tags a gzipped body as a distinct representation: "x" -> "x-gzip"
+constexpr std::string_view kGzipEtagSuffix = "-gzip";
+
+// The entry of an If-None-Match value that matches @p etag, using weak
+// comparison (RFC 9110 13.1.2) and accepting the gzip variant of the tag;
+// empty if none does
+std::string_view matching_etag(std::string_view if_none_match, std::string_view etag) {
+    while (!if_none_match.empty()) {
+        size_t comma = if_none_match.find(',');
+        std::string_view tag = if_none_match.substr(0, comma);
+        if_none_match = comma == std::string_view::npos ? std::string_view()
+                                                        : if_none_match.substr(comma + 1);
+        
+        while (!tag.empty() && (tag.front() == ' ' || tag.front() == '\t')) {
+            tag.remove_prefix(1);
+        }
+        while (!tag.empty() && (tag.back() == ' ' || tag.back() == '\t')) {
+            tag.remove_suffix(1);
+        }
+        if (tag == "*") {
+            return etag;
+        }
+        if (tag.substr(0, 2) == "W/") {
+            tag.remove_prefix(2);
+        }
+        if (tag == etag) {
+            return tag;
+        }
+        // "x-gzip" matches "x"
+        if (tag.size() == etag.size() + kGzipEtagSuffix.size() && tag.back() == '"' &&
+            tag.substr(0, etag.size() - 1) == etag.substr(0, etag.size() - 1) &&
+            tag.substr(etag.size() - 1, kGzipEtagSuffix.size()) == kGzipEtagSuffix) {
+            return tag;
+        }
+    }
+    return std::string_view();
+}
+
+/**
+ * @brief Flow control shared by a streaming handler and the event loop
+ */
+struct StreamState {
+    std::mutex mutex;
+    std::condition_variable drained;
+    size_t pending = 0;     // bytes written but not yet sent
+    bool closed = false;    // connection gone or server stopped
+};
+
+} // namespace
+
+// PIMPL implementation
+class HttpServer::Impl {
+public:
+    explicit Impl(const HttpServerOptions& options)
+        : options_(options) {}
+    
+    ~Impl() {
+        stop();
+    }
+    
+    void start();
+    void stop();
+    void wait();
+    
+    struct StreamRoute {
+        StreamHandler handler;
+        StreamPredicate streams;    // null: every request streams
+    };
+    
+    HttpServerOptions options_;
+    std::unordered_map<std::string, Handler> routes_;
+    std::unordered_map<std::string, StreamRoute> stream_routes_;
+    int port_ = 0;
+    std::atomic<bool> running_{false};
+
+private:
+    /**
+     * @brief Per-connection state, owned by the event-loop thread
+     */
+    struct Connection {
+        Connection(int socket, uint64_t connection_id, const HttpServerOptions& options)
+            : fd(socket)
+            , id(connection_id)
+            , parser(options.max_header_bytes, options.max_body_bytes)
+            , last_active(Clock::now()) {}
+        
+        int fd;
+        uint64_t id;
+        std::string in;
+        size_t in_offset = 0;
+        std::string out;
+        size_t out_offset = 0;
+        HttpRequestParser parser;
+        Clock::time_point last_active;
+        uint32_t events = EPOLLIN;
+        bool busy = false;              // a request is with the workers
+        bool read_closed = false;       // peer sent FIN
+        bool close_after_write = false;
+        std::shared_ptr<StreamState> stream;    // set while a handler streams
+    };
+    
+    /**
+     * @brief Serialized response (or part of one) handed back from a worker
+     */
+    struct Completion {
+        uint64_t id;
+        std::string data;
+        bool close;
+        bool done = true;   // false for a chunk with more to follow
+    };
+    
+    class WorkerStream;
+    
+    void run_loop();
+    void accept_connections();
+    void pause_accepting();
+    void resume_accepting();
+    void handle_read(Connection& conn);
+    void process_input(Connection& conn);
+    void dispatch(Connection& conn);
+    void flush(Connection& conn);
+    void update_interest(Connection& conn);
+    void close_connection(Connection& conn);
+    void drain_completions();
+    void sweep(Clock::time_point now);
+    void begin_shutdown();
+    
+    std::string handle_request(HttpRequest& request, bool keep_alive);
+    std::string serialize(const HttpResponse& response, bool keep_alive, bool gzip) const;
+    int decode_body(HttpRequest& request) const;
+    void handle_stream(HttpRequest& request, const StreamRoute& route, uint64_t id,
+                       bool keep_alive, std::shared_ptr<StreamState> state);
+    void run_stream(HttpRequest& request, const StreamHandler& handler, uint64_t id,
+                    bool keep_alive, std::shared_ptr<StreamState> state, int decode_status);
+    void report_progress(Connection& conn);
+    bool path_exists(const std::string& path) const;
+    void post_completion(Completion completion);
+    void wake();
+    void release_resources();
+    
+    // Whether the calling thread belongs to this server
+    bool on_server_thread() const { return current_server_ == this; }
+    
+    static thread_local const Impl* current_server_;
+    
+    int listen_fd_ = -1;
+    int epoll_fd_ = -1;
+    int wake_fd_ = -1;
+    
+    std::thread loop_thread_;
+    std::unique_ptr<ThreadPool> workers_;
+    std::unique_ptr<GrowingThreadPool> stream_threads_;    // one per open stream
+    std::atomic<bool> stopping_{false};
+    
+    std::mutex state_mutex_;
+    std::condition_variable state_cv_;
+    bool loop_done_ = true;
+    
+    std::mutex completions_mutex_;
+    std::vector<Completion> completions_;
+    
+    // Event-loop thread only
+    std::unordered_map<uint64_t, std::unique_ptr<Connection>> connections_;
+    std::vector<std::unique_ptr<Connection>> closed_;
+    uint64_t next_id_ = 2;
+    bool accept_paused_ = false;    // out of descriptors; listener not polled
+    bool shutting_down_ = false;
+    Clock::time_point shutdown_deadline_;
+};
+
+thread_local const HttpServer::Impl* HttpServer::Impl::current_server_ = nullptr;
+
+/**
+ * @brief ResponseStream that hands each chunk to the event loop
+ */
+class HttpServer::Impl::WorkerStream : public ResponseStream {
+public:
+    WorkerStream(Impl& server, uint64_t id, bool keep_alive, bool chunked, bool gzip,
+                 std::shared_ptr<StreamState> state)
+        : server_(server)
+        , id_(id)
+        , keep_alive_(keep_alive && chunked)
+        , chunked_(chunked)
+        , gzip_(gzip)
+        , state_(std::move(state)) {}
+    
+    void begin(int status, const std::map<std::string, std::string>& headers) override {
+        if (begun_ || finished_) {
+            return;
+        }
+        begun_ = true;
+        
+        // Each event is flushed on its own so the client can act on it at once
+        compressing_ = gzip_ && is_event_stream(headers) && !has_header(headers, "content-encoding");
+        if (!compressing_) {
+            post(serialize_stream_head(status, headers, chunked_, keep_alive_), false, false);
+            return;
+        }
+        
+        std::map<std::string, std::string> encoded_headers = headers;
+        encoded_headers["Content-Encoding"] = "gzip";
+        encoded_headers["Vary"] = "Accept-Encoding";
+        compressor_ = std::make_unique<GzipCompressor>();
+        compressor_->reset(server_.options_.compression_level);
+        post(serialize_stream_head(status, encoded_headers, chunked_, keep_alive_), false, false);
+    }
+    
+    bool write(std::string_view data) override {
+        if (!begun_ || finished_) {
+            return false;
+        }
+        if (data.empty()) {
+            // A zero-length chunk would end the body
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            return !state_->closed;
+        }
+        if (compressing_) {
+            compressed_.clear();
+            compressor_->write(data, compressed_);
+            return send(compressed_);
+        }
+        return send(data);
+    }
+    
+    void respond(const HttpResponse& response) override {
+        if (begun_ || finished_) {
+            return;
+        }
+        finished_ = true;
+        post(server_.serialize(response, keep_alive_, gzip_), true, !keep_alive_);
+    }
+    
+    /**
+     * @brief End the response once the handler has returned
+     */
+    void finish() {
+        if (!begun_) {
+            respond(make_response(204, std::string()));
+            return;
+        }
+        if (finished_) {
+            return;
+        }
+        if (compressing_) {
+            compressed_.clear();
+            compressor_->finish(compressed_);
+            send(compressed_);
+        }
+        finished_ = true;
+        post(chunked_ ? "0\r\n\r\n" : std::string(), true, !keep_alive_);
+    }
+    
+    /**
+     * @brief End the response after the handler threw
+     */
+    void fail(const std::string& message) {
+        if (!begun_) {
+            respond(make_response(500, error_body(message)));
+            return;
+        }
+        // Too late for an error status; cut the body short instead
+        if (!finished_) {
+            finished_ = true;
+            post(std::string(), true, true);
+        }
+    }
+
+private:
+    // Frame one piece of the body (as a chunk unless HTTP/1.0)
+    bool send(std::string_view data) {
+        if (!chunked_) {
+            return post(std::string(data), false, false);
+        }
+        
+        char size[20];
+        int size_length = snprintf(size, sizeof(size), "%zx\r\n", data.size());
+        std::string chunk;
+        chunk.reserve(static_cast<size_t>(size_length) + data.size() + 2);
+        chunk.append(size, static_cast<size_t>(size_length));
+        chunk.append(data);
+        chunk.append("\r\n");
+        return post(std::move(chunk), false, false);
+    }
+    
+    bool post(std::string data, bool done, bool close) {
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (state_->closed) {
+                return false;
+            }
+            state_->pending += data.size();
+        }
+        server_.post_completion({id_, std::move(data), close, done});
+        if (done) {
+            return true;
+        }
+        
+        // Backpressure: hold the producer until the client catches up
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->drained.wait(lock, [this] {
+            return state_->closed || state_->pending <= server_.options_.stream_high_water_bytes;
+        });
+        return !state_->closed;
+    }
+    
+    Impl& server_;
+    uint64_t id_;
+    bool keep_alive_;
+    bool chunked_;
+    bool gzip_;                 // the client accepts gzip
+    std::shared_ptr<StreamState> state_;
+    bool begun_ = false;
+    bool finished_ = false;
+    bool compressing_ = false;
+    std::unique_ptr<GzipCompressor> compressor_;   // set while compressing_
+    std::string compressed_;
+};
+
+void HttpServer::Impl::start() {
+    if (running_) {
+        return;
+    }
+    
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+    
+    addrinfo* addresses = nullptr;
+    std::string port = std::to_string(options_.port);
+    const char* host = options_.host.empty() ? nullptr : options_.host.c_str();
+    int rc = getaddrinfo(host, port.c_str(), &hints, &addresses);
+    if (rc != 0) {
+        throw A2AException(
+            "Failed to resolve " + options_.host + ": " + gai_strerror(rc),
+            ErrorCode::InternalError
+        );
+    }
+    
+    int error = 0;
+    for (addrinfo* ai = addresses; ai; ai = ai->ai_next) {
+        int fd = socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, ai->ai_protocol);
+        if (fd < 0) {
+            error = errno;
+            continue;
+        }
+        
+        int opt = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        
+        if (bind(fd, ai->ai_addr, ai->ai_addrlen) == 0 &&
+            listen(fd, options_.listen_backlog) == 0) {
+            listen_fd_ = fd;
+            break;
+        }
+        error = errno;
+        close(fd);
+    }
+    freeaddrinfo(addresses);
+    
+    if (listen_fd_ < 0) {
+        throw A2AException(
+            "Failed to listen on " + options_.host + ":" + port + ": " + std::strerror(error),
+            ErrorCode::InternalError
+        );
+    }
+    
+    sockaddr_storage bound{};
+    socklen_t bound_len = sizeof(bound);
+    getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&bound), &bound_len);
+    port_ = ntohs(bound.ss_family == AF_INET6
+                      ? reinterpret_cast<sockaddr_in6*>(&bound)->sin6_port
+                      : reinterpret_cast<sockaddr_in*>(&bound)->sin_port);
+    
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epoll_fd_ < 0 || wake_fd_ < 0) {
+        error = errno;
+        release_resources();
+        throw A2AException(
+            std::string("Failed to create event loop: ") + std::strerror(error),
+            ErrorCode::InternalError
+        );
+    }
+    
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = kListenerTag;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &ev);
+    ev.data.u64 = kWakeTag;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &ev);
+    
+    workers_ = std::make_unique<ThreadPool>(options_.worker_threads);
+    stream_threads_ = std::make_unique<GrowingThreadPool>();
+    
+    stopping_ = false;
+    shutting_down_ = false;
+    accept_paused_ = false;
+    loop_done_ = false;
+    running_ = true;
+    loop_thread_ = std::thread([this] { run_loop(); });
+}
+
+void HttpServer::Impl::stop() {
+    if (!running_) {
+        return;
+    }
+    
+    stopping_ = true;
+    wake();
+    
+    // A handler may ask the server to stop; the owner's wait() joins
+    if (!on_server_thread()) {
+        wait();
+    }
+}
+
+void HttpServer::Impl::wait() {
+    {
+        std::unique_lock<std::mutex> lock(state_mutex_);
+        state_cv_.wait(lock, [this] { return loop_done_; });
+    }
+    
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (loop_thread_.joinable()) {
+        loop_thread_.join();
+        // Runs any jobs still queued; their completions are discarded.
+        // Workers hand streams over, so they stop first
+        workers_.reset();
+        stream_threads_.reset();
+        release_resources();
+        running_ = false;
+    }
+}
+
+void HttpServer::Impl::release_resources() {
+    if (listen_fd_ >= 0) {
+        close(listen_fd_);
+        listen_fd_ = -1;
+    }
+    if (wake_fd_ >= 0) {
+        close(wake_fd_);
+        wake_fd_ = -1;
+    }
+    if (epoll_fd_ >= 0) {
+        close(epoll_fd_);
+        epoll_fd_ = -1;
+    }
+    completions_.clear();
+}
+
+void HttpServer::Impl::wake() {
+    uint64_t one = 1;
+    ssize_t written = write(wake_fd_, &one, sizeof(one));
+    (void)written;
+}
+
+void HttpServer::Impl::run_loop() {
+    current_server_ = this;
+    
+    std::vector<epoll_event> events(256);
+    Clock::time_point last_sweep = Clock::now();
+    
+    for (;;) {
+        int n = epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), 1000);
+        if (n < 0 && errno != EINTR) {
+            break;
+        }
+        
+        for (int i = 0; i < n; ++i) {
+            uint64_t tag = events[i].data.u64;
+            uint32_t flags = events[i].events;
+            
+            if (tag == kListenerTag) {
+                accept_connections();
+                continue;
+            }
+            if (tag == kWakeTag) {
+                uint64_t value;
+                ssize_t drained = read(wake_fd_, &value, sizeof(value));
+                (void)drained;
+                drain_completions();
+                continue;
+            }
+            
+            auto it = connections_.find(tag);
+            if (it == connections_.end()) {
+                continue;
+            }
+            Connection& conn = *it->second;
+            
+            if (flags & (EPOLLERR | EPOLLHUP)) {
+                close_connection(conn);
+                continue;
+            }
+            if (flags & EPOLLIN) {
+                handle_read(conn);
+            }
+            if ((flags & EPOLLOUT) && conn.fd >= 0) {
+                flush(conn);
+            }
+        }
+        
+        closed_.clear();
+        
+        if (stopping_ && !shutting_down_) {
+            begin_shutdown();
+        }
+        
+        Clock::time_point now = Clock::now();
+        if (shutting_down_ || now - last_sweep >= std::chrono::seconds(1)) {
+            // Descriptors may have been freed outside the server
+            resume_accepting();
+            sweep(now);
+            last_sweep = now;
+            closed_.clear();
+        }
+        
+        if (shutting_down_ && (connections_.empty() || now >= shutdown_deadline_)) {
+            break;
+        }
+    }
+    
+    for (auto& [id, conn] : connections_) {
+        if (conn->stream) {
+            std::lock_guard<std::mutex> lock(conn->stream->mutex);
+            conn->stream->closed = true;
+            conn->stream->drained.notify_all();
+        }
+        close(conn->fd);
+    }
+    connections_.clear();
+    current_server_ = nullptr;
+    
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        loop_done_ = true;
+    }
+    state_cv_.notify_all();
+}
+
+void HttpServer::Impl::begin_shutdown() {
+    shutting_down_ = true;
+    shutdown_deadline_ = Clock::now() + std::chrono::seconds(options_.shutdown_timeout_seconds);
+    
+    // Stop accepting; in-flight requests are answered with Connection: close
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, listen_fd_, nullptr);
+    close(listen_fd_);
+    listen_fd_ = -1;
+    
+    for (auto& [id, conn] : connections_) {
+        conn->close_after_write = true;
+    }
+}
+
+void HttpServer::Impl::sweep(Clock::time_point now) {
+    auto idle_cutoff = now - std::chrono::seconds(options_.idle_timeout_seconds);
+    
+    std::vector<Connection*> expired;
+    for (auto& [id, conn] : connections_) {
+        bool idle = !conn->busy && conn->out_offset >= conn->out.size();
+        if (idle && (shutting_down_ || conn->last_active < idle_cutoff)) {
+            expired.push_back(conn.get());
+        }
+    }
+    for (Connection* conn : expired) {
+        close_connection(*conn);
+    }
+}
+
+void HttpServer::Impl::accept_connections() {
+    for (;;) {
+        int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            // The listener stays readable while out of descriptors, so stop
+            // polling it until a connection closes or the next sweep
+            if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                pause_accepting();
+            }
+            // EAGAIN: backlog drained; anything else retries on the next wakeup
+            return;
+        }
+        
+        int opt = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+        
+        uint64_t id = next_id_++;
+        auto conn = std::make_unique<Connection>(fd, id, options_);
+        
+        epoll_event ev{};
+        ev.events = conn->events;
+        ev.data.u64 = id;
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            close(fd);
+            continue;
+        }
+        connections_.emplace(id, std::move(conn));
+    }
+}
+
+void HttpServer::Impl::pause_accepting() {
+    if (accept_paused_ || listen_fd_ < 0) {
+        return;
+    }
+    epoll_event ev{};
+    ev.data.u64 = kListenerTag;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, listen_fd_, &ev);
+    accept_paused_ = true;
+}
+
+void HttpServer::Impl::resume_accepting() {
+    if (!accept_paused_ || listen_fd_ < 0) {
+        return;
+    }
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = kListenerTag;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, listen_fd_, &ev);
+    accept_paused_ = false;
+}
+
+void HttpServer::Impl::handle_read(Connection& conn) {
+    char buffer[kReadChunk];
+    
+    // Bounded per wakeup so one busy client cannot starve the rest
+    for (int rounds = 0; rounds < 16; ++rounds) {
+        ssize_t n = recv(conn.fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            conn.in.append(buffer, static_cast<size_t>(n));
+            if (static_cast<size_t>(n) < sizeof(buffer)) {
+                break;
+            }
+            continue;
+        }
+        if (n == 0) {
+            conn.read_closed = true;
+            break;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            close_connection(conn);
+            return;
+        }
+        break;
+    }
+    
+    conn.last_active = Clock::now();
+    process_input(conn);
+    
+    if (conn.fd >= 0 && conn.read_closed && !conn.busy && conn.out_offset >= conn.out.size()) {
+        close_connection(conn);
+    }
+}
+
+void HttpServer::Impl::process_input(Connection& conn) {
+    // One request at a time per connection keeps pipelined responses in order
+    while (conn.fd >= 0 && !conn.busy && !conn.close_after_write &&
+           conn.out_offset >= conn.out.size() && conn.in_offset < conn.in.size()) {
+        size_t consumed = 0;
+        auto status = conn.parser.parse(conn.in.data() + conn.in_offset,
+                                        conn.in.size() - conn.in_offset,
+                                        consumed);
+        conn.in_offset += consumed;
+        bool expects_continue = conn.parser.take_continue();
+        
+        if (status == HttpRequestParser::Status::Incomplete) {
+            if (expects_continue) {
+                conn.out.append("HTTP/1.1 100 Continue\r\n\r\n");
+                flush(conn);
+            }
+            break;
+        }
+        
+        if (status == HttpRequestParser::Status::Error) {
+            int code = conn.parser.error_status();
+            conn.out += serialize_response(make_response(code, error_body(reason_phrase(code))), false);
+            conn.close_after_write = true;
+            flush(conn);
+            return;
+        }
+        
+        dispatch(conn);
+    }
+    
+    // Drop consumed input
+    if (conn.in_offset == conn.in.size()) {
+        conn.in.clear();
+        conn.in_offset = 0;
+    } else if (conn.in_offset > kReadChunk) {
+        conn.in.erase(0, conn.in_offset);
+        conn.in_offset = 0;
+    }
+    
+    if (conn.fd >= 0) {
+        update_interest(conn);
+    }
+}
+
+void HttpServer::Impl::dispatch(Connection& conn) {
+    conn.busy = true;
+    
+    HttpRequest request = std::move(conn.parser.request());
+    conn.parser.reset();
+    
+    bool keep_alive = request.keep_alive() && !stopping_;
+    uint64_t id = conn.id;
+    
+    // Routes are fixed once the server runs, so the handler is safe to share
+    auto stream_route = stream_routes_.find(request.method + " " + request.path);
+    if (stream_route != stream_routes_.end()) {
+        conn.stream = std::make_shared<StreamState>();
+        const StreamRoute* route = &stream_route->second;
+        workers_->submit([this, id, keep_alive, route, state = conn.stream,
+                          request = std::move(request)]() mutable {
+            current_server_ = this;
+            handle_stream(request, *route, id, keep_alive, std::move(state));
+        });
+        return;
+    }
+    
+    workers_->submit([this, id, keep_alive, request = std::move(request)]() mutable {
+        current_server_ = this;
+        std::string data = handle_request(request, keep_alive);
+        post_completion({id, std::move(data), !keep_alive});
+    });
+}
+
+std::string HttpServer::Impl::handle_request(HttpRequest& request, bool keep_alive) {
+    auto it = routes_.find(request.method + " " + request.path);
+    if (it == routes_.end()) {
+        if (path_exists(request.path)) {
+            return serialize_response(
+                make_response(405, error_body("Method Not Allowed")), keep_alive);
+        }
+        return serialize_response(make_response(404, error_body("Not Found")), keep_alive);
+    }
+    
+    if (int status = decode_body(request)) {
+        return serialize_response(make_response(status, error_body(reason_phrase(status))), keep_alive);
+    }
+    
+    try {
+        bool gzip = accepts_gzip(request.header("accept-encoding"));
+        return serialize(it->second(request), keep_alive, gzip);
+    } catch (const std::exception& e) {
+        return serialize_response(make_response(500, error_body(e.what())), keep_alive);
+    } catch (...) {
+        return serialize_response(make_response(500, error_body("Internal Server Error")), keep_alive);
+    }
+}
+
+std::string HttpServer::Impl::serialize(const HttpResponse& response, bool keep_alive,
+                                        bool gzip) const {
+    if (!gzip || options_.compression_min_bytes == 0 ||
+        response.body.size() < options_.compression_min_bytes ||
+        has_header(response.headers, "content-encoding")) {
+        return serialize_response(response, keep_alive);
+    }
+    
+    HttpResponse encoded;
+    encoded.body = gzip_compress(response.body, options_.compression_level);
+    if (encoded.body.size() >= response.body.size()) {
+        return serialize_response(response, keep_alive);
+    }
+    encoded.status_code = response.status_code;
+    encoded.headers = response.headers;
+    encoded.headers["Content-Encoding"] = "gzip";
+    encoded.headers["Vary"] = "Accept-Encoding";
+    for (auto& [name, value] : encoded.headers) {
+        // A strong tag must differ between the identity and gzip bodies
+        if (strcasecmp(name.c_str(), "etag") == 0 && value.size() >= 2 && value.back() == '"') {
+            value.insert(value.size() - 1, kGzipEtagSuffix);
+        }
+    }
+    return serialize_response(encoded, keep_alive);
+}
+
+// Inflate a gzip request body in place; returns an error status, or 0
+int HttpServer::Impl::decode_body(HttpRequest& request) const {
+    auto it = request.headers.find("content-encoding");
+    if (it == request.headers.end() || strcasecmp(it->second.c_str(), "identity") == 0) {
+        return 0;
+    }
+    if (strcasecmp(it->second.c_str(), "gzip") != 0 && strcasecmp(it->second.c_str(), "x-gzip") != 0) {
+        return 415;
+    }
+    
+    std::string body;
+    try {
+        if (!gzip_decompress(request.body, body, options_.max_body_bytes)) {
+            return 413;
+        }
+    } catch (const A2AException&) {
+        return 400;
+    }
+    request.body = std::move(body);
+    request.headers.erase(it);
+    return 0;
+}
+
+bool HttpServer::Impl::path_exists(const std::string& path) const {
+    auto matches = [&path](const std::string& route) {
+        size_t space = route.find(' ');
+        return route.compare(space + 1, std::string::npos, path) == 0;
+    };
+    for (const auto& entry : routes_) {
+        if (matches(entry.first)) {
+            return true;
+        }
+    }
+    for (const auto& entry : stream_routes_) {
+        if (matches(entry.first)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void HttpServer::Impl::handle_stream(HttpRequest& request, const StreamRoute& route,
+                                     uint64_t id, bool keep_alive,
+                                     std::shared_ptr<StreamState> state) {
+    int status = decode_body(request);
+    if (status != 0 || (route.streams && !route.streams(request))) {
+        run_stream(request, route.handler, id, keep_alive, std::move(state), status);
+        return;
+    }
+    
+    // A stream may stay open indefinitely; on a thread of its own it
+    // leaves the workers free for other requests
+    stream_threads_->submit([this, id, keep_alive, &route, state = std::move(state),
+                             request = std::move(request)]() mutable {
+        current_server_ = this;
+        run_stream(request, route.handler, id, keep_alive, std::move(state), 0);
+    });
+}
+
+void HttpServer::Impl::run_stream(HttpRequest& request, const StreamHandler& handler,
+                                  uint64_t id, bool keep_alive,
+                                  std::shared_ptr<StreamState> state, int decode_status) {
+    // HTTP/1.0 has no chunked encoding; the body then ends with the connection
+    bool chunked = request.version != "HTTP/1.0";
+    bool gzip = accepts_gzip(request.header("accept-encoding"));
+    WorkerStream stream(*this, id, keep_alive, chunked, gzip, std::move(state));
+    
+    if (decode_status != 0) {
+        stream.respond(make_response(decode_status, error_body(reason_phrase(decode_status))));
+        stream.finish();
+        return;
+    }
+    
+    try {
+        handler(request, stream);
+        stream.finish();
+    } catch (const std::exception& e) {
+        stream.fail(e.what());
+    } catch (...) {
+        stream.fail("Internal Server Error");
+    }
+}
+
+void HttpServer::Impl::post_completion(Completion completion) {
+    {
+        std::lock_guard<std::mutex> lock(completions_mutex_);
+        completions_.push_back(std::move(completion));
+    }
+    wake();
+}
+
+void HttpServer::Impl::drain_completions() {
+    std::vector<Completion> ready;
+    {
+        std::lock_guard<std::mutex> lock(completions_mutex_);
+        ready.swap(completions_);
+    }
+    
+    for (auto& completion : ready) {
+        auto it = connections_.find(completion.id);
+        if (it == connections_.end()) {
+            // Client went away while the request was being handled
+            continue;
+        }
+        Connection& conn = *it->second;
+        
+        if (conn.out.empty()) {
+            conn.out = std::move(completion.data);
+        } else {
+            conn.out += completion.data;
+        }
+        if (completion.close) {
+            conn.close_after_write = true;
+        }
+        if (completion.done) {
+            conn.busy = false;
+            conn.stream.reset();
+        }
+        flush(conn);
+    }
+}
+
+void HttpServer::Impl::flush(Connection& conn) {
+    while (conn.out_offset < conn.out.size()) {
+        ssize_t n = send(conn.fd, conn.out.data() + conn.out_offset,
+                         conn.out.size() - conn.out_offset, MSG_NOSIGNAL);
+        if (n > 0) {
+            conn.out_offset += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            update_interest(conn);
+            report_progress(conn);
+            return;
+        }
+        close_connection(conn);
+        return;
+    }
+    
+    conn.out.clear();
+    conn.out_offset = 0;
+    conn.last_active = Clock::now();
+    
+    if (conn.busy) {
+        // An interim 100 Continue or part of a streamed response was written
+        update_interest(conn);
+        report_progress(conn);
+        return;
+    }
+    
+    if (conn.close_after_write || conn.read_closed) {
+        close_connection(conn);
+        return;
+    }
+    
+    // Continue with any pipelined requests already buffered
+    process_input(conn);
+}
+
+void HttpServer::Impl::report_progress(Connection& conn) {
+    if (!conn.stream) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(conn.stream->mutex);
+    conn.stream->pending = conn.out.size() - conn.out_offset;
+    conn.stream->drained.notify_all();
+}
+
+void HttpServer::Impl::update_interest(Connection& conn) {
+    uint32_t events = 0;
+    if (conn.out_offset < conn.out.size()) {
+        events |= EPOLLOUT;
+    } else if (!conn.busy && !conn.read_closed) {
+        events |= EPOLLIN;
+    }
+    
+    if (events != conn.events) {
+        epoll_event ev{};
+        ev.events = events;
+        ev.data.u64 = conn.id;
+        epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, conn.fd, &ev);
+        conn.events = events;
+    }
+}
+
+void HttpServer::Impl::close_connection(Connection& conn) {
+    if (conn.fd < 0) {
+        return;
+    }
+    
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, conn.fd, nullptr);
+    close(conn.fd);
+    conn.fd = -1;
+    resume_accepting();
+    
+    // Unblock and stop a handler still streaming to this connection
+    if (conn.stream) {
+        std::lock_guard<std::mutex> lock(conn.stream->mutex);
+        conn.stream->closed = true;
+        conn.stream->drained.notify_all();
+    }
+    
+    // Destroyed after the current event batch; callers may still hold conn
+    auto it = connections_.find(conn.id);
+    if (it != connections_.end()) {
+        closed_.push_back(std::move(it->second));
+        connections_.erase(it);
+    }
+}
+
+HttpServer::HttpServer(const HttpServerOptions& options)
+    : impl_(std::make_unique<Impl>(options)) {}
+
+HttpServer::~HttpServer() = default;
+
+void HttpServer::route(const std::string& method, const std::string& path, Handler handler) {
+    impl_->routes_[method + " " + path] = std::move(handler);
+}
+
+void HttpServer::route_stream(const std::string& method, const std::string& path, StreamHandler handler,
+                              StreamPredicate streams) {
+    impl_->stream_routes_[method + " " + path] = Impl::StreamRoute{std::move(handler), std::move(streams)};
+}
+
+void HttpServer::mount(TaskManager& task_manager, const std::string& rpc_path) {
+    auto dispatcher = std::make_shared<JsonRpcDispatcher>();
+    dispatcher->register_task_manager(task_manager);
+    
+    // Only message/stream and tasks/resubscribe hold a stream thread; other
+    // calls are answered on a worker
+    auto streams = [dispatcher](const HttpRequest& request) {
+        return wire_format_from_content_type(request.header("content-type")) == WireFormat::Json &&
+               dispatcher->is_stream_request(request.body);
+    };
+    
+    route_stream("POST", rpc_path, [dispatcher](const HttpRequest& request, ResponseStream& stream) {
+        // CBOR requests are answered in CBOR; streams are JSON only
+        WireFormat format = wire_format_from_content_type(request.header("content-type"));
+        if (format != WireFormat::Json) {
+            std::string body = dispatcher->dispatch(request.body, format);
+            int status = body.empty() ? 204 : 200;
+            HttpResponse response = make_response(status, std::move(body));
+            response.headers["Content-Type"] = std::string(content_type(format));
+            stream.respond(std::move(response));
+            return;
+        }
+        
+        if (!dispatcher->is_stream_request(request.body)) {
+            std::string body = dispatcher->dispatch(request.body);
+            // A batch made only of notifications gets no JSON-RPC response
+            int status = body.empty() ? 204 : 200;
+            stream.respond(make_response(status, std::move(body)));
+            return;
+        }
+        
+        stream.begin(200, {{"Content-Type", "text/event-stream"}, {"Cache-Control", "no-cache"}});
+        dispatcher->dispatch_stream(request.body, [&stream](const std::string& response_json) {
+            if (response_json.empty()) {
+                return stream.write(": keep-alive\n\n");
+            }
+            // One event per response; serialized JSON never contains a raw newline
+            std::string frame;
+            frame.reserve(response_json.size() + 8);
+            frame.append("data: ").append(response_json).append("\n\n");
+            return stream.write(frame);
+        });
+    }, streams);
+    
+    std::string cache_control = "public, max-age=" + std::to_string(impl_->options_.agent_card_max_age_seconds);
+    route("GET", "/.well-known/agent-card.json", [&task_manager, cache_control](const HttpRequest& request) {
+        std::string agent_url = "http://" + request.header("host");
+        auto document = task_manager.get_agent_card_document(agent_url);
+        
+        HttpResponse response;
+        std::string_view matched = matching_etag(request.header("if-none-match"), document->etag);
+        if (!matched.empty()) {
+            // Echo the tag the client holds, which may be the gzip variant
+            response.status_code = 304;
+            response.headers["ETag"] = std::string(matched);
+        } else {
+            response.status_code = 200;
+            response.body = document->json;
+            response.headers["ETag"] = document->etag;
+        }
+        response.headers["Cache-Control"] = cache_control;
+        return response;
+    });
+}
+
+void HttpServer::start() {
+    impl_->start();
+}
+
+void HttpServer::stop() {
+    impl_->stop();
+}
+
+void HttpServer::wait() {
+    impl_->wait();
+}
+
+int HttpServer::port() const {
+    return impl_->port_;
+}
+
+bool HttpServer::is_running() const {
+    return impl_->running_;
+}
+
+} // namespace server
+} // namespace a2a
@@ -0,0 +1,576 @@
+#include <a2a/server/jsonrpc_dispatcher.hpp>
+#include <a2a/server/task_manager.hpp>
+#include <a2a/core/a2a_methods.hpp>
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/json_writer.hpp>
+#include <a2a/core/exception.hpp>
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace a2a {
+namespace server {
+
+namespace {
+
+// Request id to answer with when it is unknown
+std::string_view null_id(WireFormat format) {
+    return format == WireFormat::Cbor ? std::string_view("\xF6", 1) : std::string_view("null");
+}
+
+// id is the raw text of the request id, in the format being written
+void write_error(std::string& out, std::string_view id, int32_t code, std::string_view message,
+                 WireFormat format = WireFormat::Json) {
+    JsonWriter writer(out, format);
+    writer.begin_object();
+    writer.string_field("jsonrpc", "2.0");
+    writer.raw_field("id", id);
+    writer.key("error");
+    writer.begin_object();
+    writer.integer_field("code", code);
+    writer.string_field("message", message);
+    writer.end_object();
+    writer.end_object();
+}
+
+void write_error(std::string& out, std::string_view id, ErrorCode code, std::string_view message,
+                 WireFormat format = WireFormat::Json) {
+    write_error(out, id, static_cast<int32_t>(code), message, format);
+}
+
+void write_result(std::string& out, std::string_view id, std::string_view result,
+                  WireFormat format = WireFormat::Json) {
+    out.reserve(out.size() + result.size() + id.size() + 32);
+    JsonWriter writer(out, format);
+    writer.begin_object();
+    writer.string_field("jsonrpc", "2.0");
+    writer.raw_field("id", id);
+    writer.raw_field("result", result);
+    writer.end_object();
+}
+
+/**
+ * @brief Per-request arena for the parts arrays of decoded messages
+ *
+ * The arrays are carved out of a stack buffer (spilling to the heap if
+ * needed) and released together when the request ends; the strings inside
+ * the parts are ordinary heap allocations. Nothing that outlives the
+ * request may point into it: task stores copy the messages they are
+ * given, and MessageHistory copies any arena message it is handed, both
+ * into the default resource.
+ */
+class RequestArena {
+public:
+    RequestArena() : resource_(buffer_, sizeof(buffer_)) {}
+    
+    std::pmr::memory_resource* get() { return &resource_; }
+
+private:
+    alignas(std::max_align_t) std::byte buffer_[2048];
+    std::pmr::monotonic_buffer_resource resource_;
+};
+
+std::string_view require_params(std::string_view params) {
+    if (params.empty()) {
+        throw A2AException("Missing params", ErrorCode::InvalidParams);
+    }
+    return params;
+}
+
+template<typename Model>
+std::string serialize(const Model& model, WireFormat format) {
+    std::string out;
+    JsonWriter writer(out, format);
+    model.write_json(writer);
+    return out;
+}
+
+/**
+ * @brief Envelope fields of one request object
+ */
+struct ParsedRequest {
+    std::string_view id;
+    std::string method;
+    std::string_view params;
+    bool has_id = false;
+    bool valid = true;
+    WireFormat format = WireFormat::Json;
+    
+    /// Raw id to answer with
+    std::string_view reply_id() const { return has_id ? id : null_id(format); }
+};
+
+// Throws A2AException on malformed input
+bool parse_request(std::string_view request_data, ParsedRequest& request) {
+    JsonReader reader(request_data, request.format);
+    if (reader.peek() != JsonReader::Type::Object) {
+        return false;
+    }
+    
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "id") {
+            auto type = reader.peek();
+            if (type == JsonReader::Type::String ||
+                type == JsonReader::Type::Number ||
+                type == JsonReader::Type::Null) {
+                // Echoed back verbatim so numeric ids stay numeric
+                request.id = reader.read_raw();
+                request.has_id = true;
+            } else {
+                reader.skip_value();
+                request.valid = false;
+            }
+        } else if (key == "method") {
+            if (reader.peek() == JsonReader::Type::String) {
+                request.method = reader.read_string();
+            } else {
+                reader.skip_value();
+                request.valid = false;
+            }
+        } else if (key == "params") {
+            request.params = reader.read_raw();
+        } else {
+            reader.skip_value();
+        }
+    }
+    
+    if (request.method.empty()) {
+        request.valid = false;
+    }
+    return true;
+}
+
+/**
+ * @brief Thrown through a stream handler when the writer reports the peer gone
+ */
+struct StreamAborted {};
+
+/**
+ * @brief Handlers by method name
+ *
+ * A2A methods are found through the compile-time method table and kept
+ * in an array, so the common requests skip hashing and copying the name;
+ * other names fall back to a hash map.
+ */
+template <typename Handler>
+class MethodTable {
+public:
+    Handler& operator[](const std::string& method) {
+        if (std::optional<A2AMethod> builtin = A2AMethods::parse(method)) {
+            return builtin_[static_cast<size_t>(*builtin)];
+        }
+        return custom_[method];
+    }
+    
+    /**
+     * @return The handler, or nullptr if none is registered
+     */
+    const Handler* find(std::string_view method) const {
+        if (std::optional<A2AMethod> builtin = A2AMethods::parse(method)) {
+            const Handler& handler = builtin_[static_cast<size_t>(*builtin)];
+            return handler ? &handler : nullptr;
+        }
+        auto it = custom_.find(std::string(method));
+        return it == custom_.end() ? nullptr : &it->second;
+    }
+    
+    bool contains(std::string_view method) const {
+        return find(method) != nullptr;
+    }
+    
+    bool empty() const {
+        return custom_.empty() &&
+               std::none_of(builtin_.begin(), builtin_.end(),
+                            [](const Handler& handler) { return static_cast<bool>(handler); });
+    }
+
+private:
+    std::array<Handler, A2A_METHOD_COUNT> builtin_;
+    std::unordered_map<std::string, Handler> custom_;
+};
+
+/**
+ * @brief Shared state for one batch; helpers may outlive the dispatch call
+ */
+struct BatchState {
+    std::vector<std::string_view> items;
+    std::vector<std::string> responses;
+    std::atomic<size_t> next{0};
+    size_t remaining = 0;
+    std::mutex mutex;
+    std::condition_variable done;
+};
+
+} // namespace
+
+// PIMPL implementation
+class JsonRpcDispatcher::Impl {
+public:
+    explicit Impl(size_t batch_threads)
+        : batch_threads_(batch_threads) {}
+    
+    /**
+     * @brief Receives params and returns the result, both in the given format
+     */
+    using Handler = std::function<std::string(std::string_view params, WireFormat format)>;
+    
+    /**
+     * @brief Handle one request object, appending its response to out
+     * @return false for notifications (nothing is appended)
+     */
+    bool dispatch_one(std::string_view request_data, std::string& out, WireFormat format) const;
+    
+    void dispatch_batch(std::vector<std::string_view> items, std::string& out, WireFormat format);
+    
+    MethodTable<Handler> methods_;
+    MethodTable<StreamHandler> stream_methods_;
+
+private:
+    ThreadPool& pool() {
+        std::call_once(pool_once_, [this] {
+            pool_ = std::make_unique<ThreadPool>(batch_threads_);
+        });
+        return *pool_;
+    }
+    
+    size_t batch_threads_;
+    std::once_flag pool_once_;
+    std::unique_ptr<ThreadPool> pool_;
+};
+
+bool JsonRpcDispatcher::Impl::dispatch_one(std::string_view request_data, std::string& out,
+                                           WireFormat format) const {
+    ParsedRequest request;
+    request.format = format;
+    try {
+        if (!parse_request(request_data, request)) {
+            write_error(out, null_id(format), ErrorCode::InvalidRequest, "Invalid Request", format);
+            return true;
+        }
+    } catch (const A2AException& e) {
+        write_error(out, null_id(format), ErrorCode::ParseError, e.what(), format);
+        return true;
+    }
+    
+    const std::string& method = request.method;
+    std::string_view params = request.params;
+    bool has_id = request.has_id;
+    std::string_view reply_id = request.reply_id();
+    
+    if (!request.valid) {
+        write_error(out, reply_id, ErrorCode::InvalidRequest, "Invalid Request", format);
+        return true;
+    }
+    
+    const Handler* handler = methods_.find(method);
+    if (!handler) {
+        if (!has_id) {
+            return false;
+        }
+        if (stream_methods_.contains(method)) {
+            // Streams need a response of their own (see dispatch_stream),
+            // which is always sent as JSON events
+            write_error(out, reply_id, ErrorCode::InvalidRequest,
+                        (format == WireFormat::Json ? "Streaming method cannot be batched: "
+                                                    : "Streaming method requires a JSON request: ")
+                            + method, format);
+            return true;
+        }
+        write_error(out, reply_id, ErrorCode::MethodNotFound, "Method not found: " + method, format);
+        return true;
+    }
+    
+    std::string result;
+    try {
+        result = (*handler)(params, format);
+    } catch (const A2AException& e) {
+        if (has_id) {
+            write_error(out, reply_id, e.error_code_value(), e.what(), format);
+        }
+        return has_id;
+    } catch (const std::exception& e) {
+        if (has_id) {
+            write_error(out, reply_id, ErrorCode::InternalError, e.what(), format);
+        }
+        return has_id;
+    }
+    
+    // Notifications are executed but never answered
+    if (!has_id) {
+        return false;
+    }
+    
+    write_result(out, reply_id, result, format);
+    return true;
+}
+
+void JsonRpcDispatcher::Impl::dispatch_batch(std::vector<std::string_view> items, std::string& out,
+                                             WireFormat format) {
+    auto state = std::make_shared<BatchState>();
+    state->items = std::move(items);
+    state->responses.resize(state->items.size());
+    state->remaining = state->items.size();
+    
+    // Workers and the calling thread pull members off a shared counter, so
+    // the batch completes even if every pool thread is busy elsewhere
+    auto run = [this, state, format] {
+        for (;;) {
+            size_t i = state->next.fetch_add(1);
+            if (i >= state->items.size()) {
+                return;
+            }
+            dispatch_one(state->items[i], state->responses[i], format);
+            
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (--state->remaining == 0) {
+                state->done.notify_all();
+            }
+        }
+    };
+    
+    if (state->items.size() > 1) {
+        size_t helpers = std::min(state->items.size() - 1, pool().size());
+        for (size_t i = 0; i < helpers; ++i) {
+            pool().submit(run);
+        }
+    }
+    run();
+    
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&state] { return state->remaining == 0; });
+    }
+    
+    // Splice member responses into the array; notifications leave no entry
+    if (format == WireFormat::Cbor) {
+        auto answered = std::count_if(state->responses.begin(), state->responses.end(),
+                                      [](const std::string& response) { return !response.empty(); });
+        if (answered == 0) {
+            return;
+        }
+        JsonWriter writer(out, format);
+        writer.begin_array();
+        for (const auto& response : state->responses) {
+            if (!response.empty()) {
+                writer.raw(response);
+            }
+        }
+        writer.end_array();
+        return;
+    }
+    
+    size_t total = 2;
+    for (const auto& response : state->responses) {
+        total += response.size() + 1;
+    }
+    out.reserve(out.size() + total);
+    
+    bool first = true;
+    for (const auto& response : state->responses) {
+        if (response.empty()) {
+            continue;
+        }
+        out.push_back(first ? '[' : ',');
+        out.append(response);
+        first = false;
+    }
+    if (!first) {
+        out.push_back(']');
+    }
+}
+
+JsonRpcDispatcher::JsonRpcDispatcher(size_t batch_threads)
+    : impl_(std::make_unique<Impl>(batch_threads)) {}
+
+JsonRpcDispatcher::~JsonRpcDispatcher() = default;
+
+void JsonRpcDispatcher::register_method(const std::string& method, MethodHandler handler) {
+    impl_->methods_[method] = [handler = std::move(handler)](std::string_view params,
+                                                              WireFormat format) {
+        if (format == WireFormat::Json) {
+            return handler(params);
+        }
+        
+        // JSON-only handler: convert params in and the result out
+        std::string params_json = params.empty() ? std::string()
+                                                 : transcode(params, format, WireFormat::Json);
+        std::string result = handler(params_json);
+        return result.empty() ? result : transcode(result, WireFormat::Json, format);
+    };
+}
+
+void JsonRpcDispatcher::register_task_manager(TaskManager& task_manager) {
+    // Registered directly so params and results never pass through JSON
+    // text when the request is CBOR
+    impl_->methods_[A2AMethods::MESSAGE_SEND] = [&task_manager](std::string_view params_data,
+                                                                WireFormat format) {
+        // Parts are decoded only if the handler needs them
+        RequestArena arena;
+        auto params = MessageSendParamsView::parse(require_params(params_data), format);
+        A2AResponse response = task_manager.send_message(params, arena.get());
+        return response.is_task() ? serialize(response.as_task(), format)
+                                  : serialize(response.as_message(), format);
+    };
+    
+    impl_->methods_[A2AMethods::TASK_GET] = [&task_manager](std::string_view params_data,
+                                                            WireFormat format) {
+        JsonReader reader(require_params(params_data), format);
+        auto params = TaskQueryParams::read_json(reader);
+        return serialize(task_manager.get_task(params.id), format);
+    };
+    
+    impl_->methods_[A2AMethods::TASK_CANCEL] = [&task_manager](std::string_view params_data,
+                                                               WireFormat format) {
+        JsonReader reader(require_params(params_data), format);
+        auto params = TaskIdParams::read_json(reader);
+        return serialize(task_manager.cancel_task(params.id), format);
+    };
+    
+    register_stream_method(A2AMethods::MESSAGE_STREAM,
+        [&task_manager](std::string_view params_json,
+                        const std::function<void(const std::string&)>& emit) {
+            RequestArena arena;
+            auto params = MessageSendParams::from_json(require_params(params_json), arena.get());
+            task_manager.send_message_streaming(params, emit);
+        });
+    
+    register_stream_method(A2AMethods::TASK_SUBSCRIBE,
+        [&task_manager](std::string_view params_json,
+                        const std::function<void(const std::string&)>& emit) {
+            auto params = TaskIdParams::from_json(require_params(params_json));
+            task_manager.resubscribe(params.id, emit);
+        });
+}
+
+void JsonRpcDispatcher::register_stream_method(const std::string& method, StreamHandler handler) {
+    impl_->stream_methods_[method] = std::move(handler);
+}
+
+bool JsonRpcDispatcher::has_method(const std::string& method) const {
+    return impl_->methods_.contains(method) || impl_->stream_methods_.contains(method);
+}
+
+std::string JsonRpcDispatcher::dispatch(std::string_view body, WireFormat format) {
+    std::string out;
+    JsonReader reader(body, format);
+    
+    try {
+        if (reader.peek() != JsonReader::Type::Array) {
+            impl_->dispatch_one(body, out, format);
+            return out;
+        }
+        
+        // Members are located (and syntax-checked) up front, then handled
+        std::vector<std::string_view> items;
+        reader.begin_array();
+        while (reader.next_element()) {
+            items.push_back(reader.read_raw());
+        }
+        
+        if (items.empty()) {
+            write_error(out, null_id(format), ErrorCode::InvalidRequest, "Invalid Request", format);
+            return out;
+        }
+        
+        impl_->dispatch_batch(std::move(items), out, format);
+    } catch (const A2AException& e) {
+        out.clear();
+        write_error(out, null_id(format), ErrorCode::ParseError, e.what(), format);
+    }
+    
+    return out;
+}
+
+bool JsonRpcDispatcher::is_stream_request(std::string_view body) const {
+    if (impl_->stream_methods_.empty()) {
+        return false;
+    }
+    
+    // Only the envelope up to "method" is read; params are left unscanned
+    try {
+        JsonReader reader(body);
+        if (reader.peek() != JsonReader::Type::Object) {
+            return false;
+        }
+        
+        reader.begin_object();
+        std::string_view key;
+        while (reader.next_key(key)) {
+            if (key != "method") {
+                reader.skip_value();
+                continue;
+            }
+            if (reader.peek() != JsonReader::Type::String) {
+                return false;
+            }
+            return impl_->stream_methods_.contains(reader.read_string_view());
+        }
+    } catch (const A2AException&) {
+        // Malformed bodies are reported by dispatch()
+    }
+    return false;
+}
+
+void JsonRpcDispatcher::dispatch_stream(std::string_view body, const StreamWriter& write) {
+    ParsedRequest request;
+    std::string out;
+    
+    try {
+        if (!parse_request(body, request) || !request.valid) {
+            write_error(out, request.reply_id(), ErrorCode::InvalidRequest, "Invalid Request");
+            write(out);
+            return;
+        }
+    } catch (const A2AException& e) {
+        write_error(out, "null", ErrorCode::ParseError, e.what());
+        write(out);
+        return;
+    }
+    
+    std::string_view reply_id = request.reply_id();
+    
+    const StreamHandler* handler = impl_->stream_methods_.find(request.method);
+    if (!handler) {
+        write_error(out, reply_id, ErrorCode::MethodNotFound, "Method not found: " + request.method);
+        write(out);
+        return;
+    }
+    
+    auto emit = [&write, &out, reply_id](const std::string& result) {
+        out.clear();
+        if (!result.empty()) {
+            write_result(out, reply_id, result);
+        }
+        if (!write(out)) {
+            throw StreamAborted{};
+        }
+    };
+    
+    try {
+        (*handler)(request.params, emit);
+    } catch (const StreamAborted&) {
+        return;
+    } catch (const A2AException& e) {
+        out.clear();
+        write_error(out, reply_id, e.error_code_value(), e.what());
+        write(out);
+    } catch (const std::exception& e) {
+        out.clear();
+        write_error(out, reply_id, ErrorCode::InternalError, e.what());
+        write(out);
+    }
+}
+
+} // namespace server
+} // namespace a2a
@@ -1,89 +1,209 @@
 #include <a2a/server/memory_task_store.hpp>
+#include "task_size.hpp"
 #include <algorithm>
+#include <mutex>
+#include <thread>
 
 namespace a2a {
 
+using server::approximate_size;
+
+namespace {
+
+// Shards kept at least this full when max_tasks limits the store
+constexpr size_t MIN_TASKS_PER_SHARD = 64;
+
+// Expired tasks removed per hold of a shard's lock
+constexpr size_t REAP_BATCH = 256;
+
+} // namespace
+
+MemoryTaskStore::MemoryTaskStore(size_t shard_count)
+    : MemoryTaskStore(MemoryTaskStoreOptions{shard_count}) {}
+
+MemoryTaskStore::MemoryTaskStore(const MemoryTaskStoreOptions& options)
+    : options_(options) {
+    size_t shard_count = options_.shard_count;
+    if (shard_count == 0) {
+        // A few shards per core keeps collisions between busy tasks rare
+        shard_count = std::max<size_t>(std::thread::hardware_concurrency(), 1) * 4;
+        // but the per-shard share of a small task limit must stay useful
+        if (options_.max_tasks != 0) {
+            shard_count = std::clamp<size_t>(options_.max_tasks / MIN_TASKS_PER_SHARD, 1, shard_count);
+        }
+    }
+    
+    size_t shards = 1;
+    while (shards < shard_count && shards < 4096) {
+        shards <<= 1;
+    }
+    
+    shards_ = std::make_unique<Shard[]>(shards);
+    shard_mask_ = shards - 1;
+    
+    // Limits are split evenly, rounding up
+    if (options_.max_tasks != 0) {
+        shard_max_tasks_ = (options_.max_tasks + shards - 1) / shards;
+    }
+    if (options_.max_bytes != 0) {
+        shard_max_bytes_ = (options_.max_bytes + shards - 1) / shards;
+    }
+    
+    if (options_.terminal_ttl.count() > 0 && options_.reap_interval.count() > 0) {
+        reaper_ = std::thread([this] { reap(); });
+    }
+}
+
+MemoryTaskStore::~MemoryTaskStore() {
+    {
+        std::lock_guard<std::mutex> lock(reaper_mutex_);
+        reaper_stopping_ = true;
+    }
+    reaper_wakeup_.notify_one();
+    if (reaper_.joinable()) {
+        reaper_.join();
+    }
+}
+
 std::optional<AgentTask> MemoryTaskStore::get_task(const std::string& task_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    Shard& shard = shard_for(task_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
     
-    auto it = tasks_.find(task_id);
-    if (it != tasks_.end()) {
-        return it->second;
+    auto it = shard.tasks.find(task_id);
+    if (it != shard.tasks.end()) {
+        touch(shard, it->second);
+        return *it->second.task;
     }
     
     return std::nullopt;
 }
 
+std::shared_ptr<const AgentTask> MemoryTaskStore::get_task_snapshot(const std::string& task_id) {
+    Shard& shard = shard_for(task_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    
+    auto it = shard.tasks.find(task_id);
+    if (it != shard.tasks.end()) {
+        touch(shard, it->second);
+        return it->second.task;
+    }
+    
+    return nullptr;
+}
+
 void MemoryTaskStore::set_task(const AgentTask& task) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    tasks_[task.id()] = task;
+    auto copy = std::make_shared<AgentTask>(task);
+    if (options_.max_history != 0) {
+        copy->set_history_capacity(options_.max_history);
+    }
+    size_t bytes = approximate_size(*copy);
+    
+    Shard& shard = shard_for(task.id());
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    
+    auto [it, inserted] = shard.tasks.try_emplace(task.id());
+    Entry& entry = it->second;
+    entry.task = std::move(copy);
+    if (inserted) {
+        shard.lru.push_front(&it->first);
+        entry.lru = shard.lru.begin();
+    } else {
+        touch(shard, entry);
+    }
+    // A replaced task counts as new, so its expiry restarts
+    updated(shard, entry, false, bytes);
+    evict(shard);
 }
 
 void MemoryTaskStore::update_status(const std::string& task_id,
                                     TaskState status,
                                     const std::string& message) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    Shard& shard = shard_for(task_id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
     
-    auto it = tasks_.find(task_id);
-    if (it != tasks_.end()) {
+    auto it = shard.tasks.find(task_id);
+    if (it != shard.tasks.end()) {
         AgentTaskStatus new_status(status);
         if (!message.empty()) {
             new_status.set_message(message);
         }
-        it->second.set_status(new_status);
+        
+        Entry& entry = it->second;
+        bool was_terminal = entry.task->is_terminal();
+        size_t bytes = entry.bytes - entry.task->status().message().size() + new_status.message().size();
+        writable(entry.task).set_status(new_status);
+        touch(shard, entry);
+        updated(shard, entry, was_terminal, bytes);
+        evict(shard);
     }
 }
 
 void MemoryTaskStore::add_artifact(const std::string& task_id,
                                    const Artifact& artifact) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    Shard& shard = shard_for(task_id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
     
-    auto it = tasks_.find(task_id);
-    if (it != tasks_.end()) {
-        it->second.add_artifact(artifact);
+    auto it = shard.tasks.find(task_id);
+    if (it != shard.tasks.end()) {
+        Entry& entry = it->second;
+        writable(entry.task).add_artifact(artifact);
+        touch(shard, entry);
+        updated(shard, entry, entry.task->is_terminal(), entry.bytes + approximate_size(artifact));
+        evict(shard);
     }
 }
 
 void MemoryTaskStore::add_history_message(const std::string& task_id,
                                           const AgentMessage& message) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    Shard& shard = shard_for(task_id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
     
-    auto it = tasks_.find(task_id);
-    if (it != tasks_.end()) {
-        it->second.add_history_message(message);
+    auto it = shard.tasks.find(task_id);
+    if (it != shard.tasks.end()) {
+        Entry& entry = it->second;
+        size_t bytes = entry.bytes + approximate_size(message);
+        const MessageHistory& history = entry.task->history();
+        if (history.capacity() != 0 && history.size() == history.capacity()) {
+            // The oldest message makes room
+            bytes -= approximate_size(history.front());
+        }
+        writable(entry.task).add_history_message(message);
+        touch(shard, entry);
+        updated(shard, entry, entry.task->is_terminal(), bytes);
+        evict(shard);
     }
 }
 
 std::vector<AgentMessage> MemoryTaskStore::get_history(const std::string& context_id,
                                                         int max_length) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    // 查找对应的 task
-    auto it = tasks_.find(context_id);
-    if (it == tasks_.end()) {
-        return {};
+    // 只复制最近的 max_length 条消息
+    std::vector<AgentMessage> history;
+    for (const auto& message : get_history_tail(context_id, max_length > 0 ? max_length : 0)) {
+        history.push_back(*message);
     }
+    return history;
+}
+
+std::vector<std::shared_ptr<const AgentMessage>> MemoryTaskStore::get_history_tail(const std::string& context_id,
+                                                                                   size_t max_length) {
+    Shard& shard = shard_for(context_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
     
-    const auto& history = it->second.history();
-    
-    // 如果 max_length <= 0 或大于历史长度，返回全部
-    if (max_length <= 0 || static_cast<size_t>(max_length) >= history.size()) {
-        return history;
+    auto it = shard.tasks.find(context_id);
+    if (it == shard.tasks.end()) {
+        return {};
     }
-    
-    // 返回最近的 max_length 条消息
-    return std::vector<AgentMessage>(
-        history.end() - max_length,
-        history.end()
-    );
+    touch(shard, it->second);
+    return it->second.task->history().tail(max_length);
 }
 
 bool MemoryTaskStore::delete_task(const std::string& task_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    Shard& shard = shard_for(task_id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
     
-    auto it = tasks_.find(task_id);
-    if (it != tasks_.end()) {
-        tasks_.erase(it);
+    auto it = shard.tasks.find(task_id);
+    if (it != shard.tasks.end()) {
+        erase(shard, it);
         return true;
     }
     
@@ -91,18 +211,116 @@ bool MemoryTaskStore::delete_task(const std::string& task_id) {
 }
 
 bool MemoryTaskStore::task_exists(const std::string& task_id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return tasks_.find(task_id) != tasks_.end();
+    Shard& shard = shard_for(task_id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tasks.find(task_id) != shard.tasks.end();
 }
 
 size_t MemoryTaskStore::size() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return tasks_.size();
+    size_t total = 0;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+        total += shards_[i].tasks.size();
+    }
+    return total;
+}
+
+size_t MemoryTaskStore::bytes() const {
+    size_t total = 0;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+        total += shards_[i].bytes;
+    }
+    return total;
 }
 
 void MemoryTaskStore::clear() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    tasks_.clear();
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+        shards_[i].tasks.clear();
+        shards_[i].lru.clear();
+        shards_[i].expiring.clear();
+        shards_[i].bytes = 0;
+    }
+}
+
+size_t MemoryTaskStore::remove_expired() {
+    if (options_.terminal_ttl.count() <= 0) {
+        return 0;
+    }
+    
+    Clock::time_point now = Clock::now();
+    size_t removed = 0;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        removed += remove_expired(shards_[i], now);
+    }
+    return removed;
+}
+
+void MemoryTaskStore::touch(Shard& shard, Entry& entry) const {
+    // Recency only matters when something may be evicted
+    if (!bounded()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(shard.lru_mutex);
+    shard.lru.splice(shard.lru.begin(), shard.lru, entry.lru);
+}
+
+void MemoryTaskStore::updated(Shard& shard, Entry& entry, bool was_terminal, size_t bytes) const {
+    shard.bytes = shard.bytes - entry.bytes + bytes;
+    entry.bytes = bytes;
+    
+    if (!was_terminal && entry.task->is_terminal() && options_.terminal_ttl.count() > 0) {
+        entry.terminal_since = Clock::now();
+        shard.expiring.emplace_back(entry.terminal_since, **entry.lru);
+    }
+}
+
+void MemoryTaskStore::evict(Shard& shard) const {
+    while (shard.tasks.size() > 1 &&
+           ((shard_max_tasks_ != 0 && shard.tasks.size() > shard_max_tasks_) ||
+            (shard_max_bytes_ != 0 && shard.bytes > shard_max_bytes_))) {
+        erase(shard, shard.tasks.find(*shard.lru.back()));
+    }
+}
+
+void MemoryTaskStore::erase(Shard& shard, Tasks::iterator it) const {
+    shard.bytes -= it->second.bytes;
+    shard.lru.erase(it->second.lru);
+    // Any entry in expiring is skipped once the task is gone
+    shard.tasks.erase(it);
+}
+
+size_t MemoryTaskStore::remove_expired(Shard& shard, Clock::time_point now) {
+    size_t removed = 0;
+    for (;;) {
+        // Let other threads at the shard between batches
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        for (size_t i = 0; i < REAP_BATCH; ++i) {
+            if (shard.expiring.empty() || now - shard.expiring.front().first < options_.terminal_ttl) {
+                return removed;
+            }
+            
+            const auto& [since, task_id] = shard.expiring.front();
+            auto it = shard.tasks.find(task_id);
+            // Still the same terminal task that was queued
+            if (it != shard.tasks.end() && it->second.task->is_terminal() &&
+                it->second.terminal_since == since) {
+                erase(shard, it);
+                ++removed;
+            }
+            shard.expiring.pop_front();
+        }
+    }
+}
+
+void MemoryTaskStore::reap() {
+    std::unique_lock<std::mutex> lock(reaper_mutex_);
+    while (!reaper_wakeup_.wait_for(lock, options_.reap_interval, [this] { return reaper_stopping_; })) {
+        lock.unlock();
+        remove_expired();
+        lock.lock();
+    }
 }
 
 } // namespace a2a
@@ -0,0 +1,674 @@
+#include <a2a/server/redis_task_store.hpp>
+#include <a2a/core/exception.hpp>
+#include <a2a/core/id_generator.hpp>
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/json_writer.hpp>
+#include <hiredis/hiredis.h>
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+namespace a2a {
+
+namespace {
+
+struct ReplyDeleter {
+    void operator()(redisReply* reply) const { freeReplyObject(reply); }
+};
+
+using Reply = std::unique_ptr<redisReply, ReplyDeleter>;
+
+struct ContextDeleter {
+    void operator()(redisContext* context) const { redisFree(context); }
+};
+
+using Context = std::unique_ptr<redisContext, ContextDeleter>;
+
+// Every script takes KEYS = {task hash, artifacts list, history list}
+
+// ARGV: id, contextId, status, metadata, artifact count, artifacts..., history...
+constexpr const char* SET_TASK_SCRIPT = R"lua(
+redis.call('DEL', KEYS[1], KEYS[2], KEYS[3])
+redis.call('HSET', KEYS[1], 'id', ARGV[1], 'contextId', ARGV[2], 'status', ARGV[3], 'metadata', ARGV[4])
+local artifacts = tonumber(ARGV[5])
+for i = 6, 5 + artifacts do
+    redis.call('RPUSH', KEYS[2], ARGV[i])
+end
+for i = 6 + artifacts, #ARGV do
+    redis.call('RPUSH', KEYS[3], ARGV[i])
+end
+return 1
+)lua";
+
+// Returns nil if the task does not exist
+constexpr const char* GET_TASK_SCRIPT = R"lua(
+local fields = redis.call('HGETALL', KEYS[1])
+if #fields == 0 then
+    return false
+end
+return {fields, redis.call('LRANGE', KEYS[2], 0, -1), redis.call('LRANGE', KEYS[3], 0, -1)}
+)lua";
+
+// ARGV: status
+constexpr const char* UPDATE_STATUS_SCRIPT = R"lua(
+if redis.call('EXISTS', KEYS[1]) == 0 then
+    return 0
+end
+redis.call('HSET', KEYS[1], 'status', ARGV[1])
+return 1
+)lua";
+
+// Returns 1 if the task existed
+constexpr const char* DELETE_TASK_SCRIPT = R"lua(
+local existed = redis.call('DEL', KEYS[1])
+redis.call('DEL', KEYS[2], KEYS[3])
+return existed
+)lua";
+
+// ARGV: channel, message. A script rather than a plain PUBLISH so that a
+// NOSCRIPT retry of the write before it cannot overtake it
+constexpr const char* PUBLISH_SCRIPT = R"lua(
+return redis.call('PUBLISH', ARGV[1], ARGV[2])
+)lua";
+
+// ARGV: list (2 = artifacts, 3 = history), value, maximum length (0 = unbounded)
+constexpr const char* APPEND_SCRIPT = R"lua(
+if redis.call('EXISTS', KEYS[1]) == 0 then
+    return 0
+end
+local list = KEYS[tonumber(ARGV[1])]
+redis.call('RPUSH', list, ARGV[2])
+local max = tonumber(ARGV[3])
+if max > 0 then
+    redis.call('LTRIM', list, -max, -1)
+end
+return 1
+)lua";
+
+timeval to_timeval(std::chrono::milliseconds duration) {
+    timeval tv{};
+    tv.tv_sec = static_cast<time_t>(duration.count() / 1000);
+    tv.tv_usec = static_cast<suseconds_t>((duration.count() % 1000) * 1000);
+    return tv;
+}
+
+std::string_view reply_string(const redisReply* reply) {
+    return reply->type == REDIS_REPLY_STRING ? std::string_view(reply->str, reply->len)
+                                             : std::string_view();
+}
+
+A2AException connection_error(const redisContext* context) {
+    return A2AException(std::string("Redis connection error: ") +
+                        (context ? context->errstr : "cannot allocate context"),
+                        ErrorCode::InternalError);
+}
+
+// Throws for an error reply
+Reply checked(Reply reply) {
+    if (reply->type == REDIS_REPLY_ERROR) {
+        throw A2AException("Redis error: " + std::string(reply->str, reply->len),
+                           ErrorCode::InternalError);
+    }
+    return reply;
+}
+
+void append_command(redisContext* context, const std::vector<std::string>& args) {
+    std::vector<const char*> argv;
+    std::vector<size_t> lengths;
+    argv.reserve(args.size());
+    lengths.reserve(args.size());
+    for (const std::string& arg : args) {
+        argv.push_back(arg.data());
+        lengths.push_back(arg.size());
+    }
+    redisAppendCommandArgv(context, static_cast<int>(argv.size()), argv.data(), lengths.data());
+}
+
+// Run one command and wait for its reply (only used while connecting)
+Reply run_command(redisContext* context, const std::vector<std::string>& args) {
+    append_command(context, args);
+    void* reply = nullptr;
+    if (redisGetReply(context, &reply) != REDIS_OK || !reply) {
+        throw connection_error(context);
+    }
+    return checked(Reply(static_cast<redisReply*>(reply)));
+}
+
+Context connect(const RedisTaskStoreOptions& options) {
+    Context context(redisConnectWithTimeout(options.host.c_str(), options.port,
+                                            to_timeval(options.connect_timeout)));
+    if (!context || context->err) {
+        throw A2AException("Failed to connect to Redis at " + options.host + ":" +
+                           std::to_string(options.port) + ": " +
+                           (context ? context->errstr : "cannot allocate context"),
+                           ErrorCode::InternalError);
+    }
+    redisSetTimeout(context.get(), to_timeval(options.command_timeout));
+    redisEnableKeepAlive(context.get());
+    
+    if (!options.password.empty()) {
+        run_command(context.get(), {"AUTH", options.password});
+    }
+    if (options.database != 0) {
+        run_command(context.get(), {"SELECT", std::to_string(options.database)});
+    }
+    return context;
+}
+
+/**
+ * @brief A command waiting for its pipeline
+ */
+struct Request {
+    std::vector<std::string> args;
+    const char* script = nullptr;  ///< Source to EVAL instead if the server lacks the SHA
+    std::promise<Reply> reply;
+};
+
+/**
+ * @brief One pooled connection and the thread that pipelines its requests
+ *
+ * Requests queue up while a pipeline is in flight and all go out in the
+ * next one: every command is written, then every reply read, so a batch
+ * costs one round trip however many callers contributed to it.
+ */
+class Connection {
+public:
+    Connection(const RedisTaskStoreOptions& options, Context context)
+        : options_(options)
+        , context_(std::move(context))
+        , thread_([this] { run(); }) {}
+    
+    ~Connection() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        ready_.notify_one();
+        thread_.join();
+    }
+    
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+    
+    std::future<Reply> submit(std::vector<std::string> args, const char* script) {
+        Request request;
+        request.args = std::move(args);
+        request.script = script;
+        std::future<Reply> reply = request.reply.get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(std::move(request));
+        }
+        ready_.notify_one();
+        return reply;
+    }
+
+private:
+    void run() {
+        std::vector<Request> batch;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (queue_.empty()) {
+                    // Stopping, and everything queued has been sent
+                    return;
+                }
+                size_t count = std::min(queue_.size(), std::max<size_t>(options_.max_pipeline, 1));
+                batch.assign(std::make_move_iterator(queue_.begin()),
+                             std::make_move_iterator(queue_.begin() + static_cast<std::ptrdiff_t>(count)));
+                queue_.erase(queue_.begin(), queue_.begin() + static_cast<std::ptrdiff_t>(count));
+            }
+            
+            std::vector<Request*> pending;
+            pending.reserve(batch.size());
+            for (Request& request : batch) {
+                pending.push_back(&request);
+            }
+            execute(pending);
+            batch.clear();
+        }
+    }
+    
+    void execute(const std::vector<Request*>& batch) {
+        if (!context_) {
+            try {
+                context_ = connect(options_);
+            } catch (const A2AException&) {
+                fail(batch, 0, std::current_exception());
+                return;
+            }
+        }
+        
+        for (Request* request : batch) {
+            append_command(context_.get(), request->args);
+        }
+        
+        std::vector<Request*> missing_scripts;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            void* raw = nullptr;
+            if (redisGetReply(context_.get(), &raw) != REDIS_OK || !raw) {
+                // The context is unusable after an I/O error; reconnect next
+                // time. Not retried: the commands may already have run.
+                A2AException error = connection_error(context_.get());
+                context_.reset();
+                std::exception_ptr failure = std::make_exception_ptr(error);
+                fail(batch, i, failure);
+                // Their retries were never sent, but the callers still wait
+                fail(missing_scripts, 0, failure);
+                return;
+            }
+            
+            Reply reply(static_cast<redisReply*>(raw));
+            // The script cache is empty after SCRIPT FLUSH: send the source
+            if (batch[i]->script && reply->type == REDIS_REPLY_ERROR &&
+                std::string_view(reply->str, reply->len).substr(0, 8) == "NOSCRIPT") {
+                batch[i]->args[0] = "EVAL";
+                batch[i]->args[1] = batch[i]->script;
+                batch[i]->script = nullptr;
+                missing_scripts.push_back(batch[i]);
+                continue;
+            }
+            batch[i]->reply.set_value(std::move(reply));
+        }
+        
+        if (!missing_scripts.empty()) {
+            execute(missing_scripts);
+        }
+    }
+    
+    static void fail(const std::vector<Request*>& batch, size_t from, std::exception_ptr error) {
+        for (size_t i = from; i < batch.size(); ++i) {
+            batch[i]->reply.set_exception(error);
+        }
+    }
+    
+    const RedisTaskStoreOptions& options_;
+    Context context_;  ///< Only touched by thread_ once it runs
+    
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::vector<Request> queue_;
+    bool stopping_ = false;
+    
+    std::thread thread_;
+};
+
+// Apply f to the checked reply when the returned future is waited on
+template <typename F>
+auto then(std::future<Reply> reply, F f) {
+    return std::async(std::launch::deferred,
+                      [reply = std::move(reply), f = std::move(f)]() mutable {
+                          return f(checked(reply.get()));
+                      });
+}
+
+} // namespace
+
+// PIMPL implementation
+class RedisTaskStore::Impl {
+public:
+    /**
+     * @brief A server-side script and its SHA1, loaded at construction
+     */
+    struct Script {
+        const char* source;
+        std::string sha;
+    };
+    
+    explicit Impl(const RedisTaskStoreOptions& options)
+        : options_(options)
+        , channel_(options.key_prefix + "changes")
+        , origin_(generate_id()) {
+        size_t count = std::max<size_t>(options_.connections, 1);
+        std::vector<Context> contexts;
+        for (size_t i = 0; i < count; ++i) {
+            contexts.push_back(connect(options_));
+        }
+        
+        // The server's script cache is shared by every connection
+        for (Script* script : {&set_task_, &get_task_, &update_status_, &append_, &delete_task_, &publish_}) {
+            Reply sha = run_command(contexts.front().get(), {"SCRIPT", "LOAD", script->source});
+            script->sha.assign(sha->str, sha->len);
+        }
+        
+        for (Context& context : contexts) {
+            connections_.push_back(std::make_unique<Connection>(options_, std::move(context)));
+        }
+    }
+    
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(subscriber_mutex_);
+            subscriber_stopping_ = true;
+            // Wakes the subscriber from its blocking read
+            if (subscriber_fd_ >= 0) {
+                ::shutdown(subscriber_fd_, SHUT_RDWR);
+            }
+        }
+        subscriber_wakeup_.notify_one();
+        if (subscriber_.joinable()) {
+            subscriber_.join();
+        }
+    }
+    
+    /**
+     * @brief Keys of one task (hash, artifacts, history)
+     */
+    std::array<std::string, 3> keys(const std::string& task_id) const {
+        std::string hash = options_.key_prefix + "task:{" + task_id + "}";
+        return {hash, hash + ":artifacts", hash + ":history"};
+    }
+    
+    /**
+     * @brief Queue one command about a task (arguments are binary-safe)
+     */
+    std::future<Reply> command(const std::string& task_id, std::vector<std::string> args) {
+        return connection_for(task_id).submit(std::move(args), nullptr);
+    }
+    
+    /**
+     * @brief Queue a script run on a task's keys
+     */
+    std::future<Reply> eval(const Script& script, const std::string& task_id,
+                            std::vector<std::string> args) {
+        auto task_keys = keys(task_id);
+        std::vector<std::string> argv;
+        argv.reserve(6 + args.size());
+        argv.insert(argv.end(), {"EVALSHA", script.sha, "3"});
+        argv.insert(argv.end(), std::make_move_iterator(task_keys.begin()),
+                    std::make_move_iterator(task_keys.end()));
+        argv.insert(argv.end(), std::make_move_iterator(args.begin()),
+                    std::make_move_iterator(args.end()));
+        return connection_for(task_id).submit(std::move(argv), script.source);
+    }
+    
+    /**
+     * @brief Queue a script that changes a task, announcing the change if
+     * publish_changes is set
+     */
+    std::future<Reply> write(const Script& script, const std::string& task_id,
+                             std::vector<std::string> args) {
+        std::future<Reply> reply = eval(script, task_id, std::move(args));
+        if (options_.publish_changes) {
+            // Same connection, so subscribers hear of the write after it ran
+            eval(publish_, task_id, {channel_, origin_ + " " + task_id});
+        }
+        return reply;
+    }
+    
+    void subscribe(std::function<void(const std::string&)> on_change) {
+        std::lock_guard<std::mutex> lock(subscriber_mutex_);
+        on_change_ = std::move(on_change);
+        if (!subscriber_.joinable()) {
+            subscriber_ = std::thread([this] { run_subscriber(); });
+        }
+    }
+    
+    RedisTaskStoreOptions options_;
+    
+    Script set_task_{SET_TASK_SCRIPT, {}};
+    Script get_task_{GET_TASK_SCRIPT, {}};
+    Script update_status_{UPDATE_STATUS_SCRIPT, {}};
+    Script append_{APPEND_SCRIPT, {}};
+    Script delete_task_{DELETE_TASK_SCRIPT, {}};
+    Script publish_{PUBLISH_SCRIPT, {}};
+
+private:
+    /**
+     * @brief Connection that carries every request about a task, so
+     * requests about one task run in the order they were made
+     */
+    Connection& connection_for(const std::string& task_id) {
+        return *connections_[std::hash<std::string>()(task_id) % connections_.size()];
+    }
+    
+    void run_subscriber() {
+        bool resubscribed = false;
+        for (;;) {
+            Context context;
+            try {
+                context = connect(options_);
+                // Wait for messages indefinitely
+                redisSetTimeout(context.get(), to_timeval(std::chrono::milliseconds(0)));
+                run_command(context.get(), {"SUBSCRIBE", channel_});
+            } catch (const A2AException&) {
+                context.reset();
+            }
+            
+            if (context) {
+                {
+                    std::lock_guard<std::mutex> lock(subscriber_mutex_);
+                    if (subscriber_stopping_) {
+                        return;
+                    }
+                    subscriber_fd_ = context->fd;
+                }
+                if (resubscribed) {
+                    notify("");
+                }
+                resubscribed = true;
+                
+                void* raw = nullptr;
+                while (redisGetReply(context.get(), &raw) == REDIS_OK && raw) {
+                    Reply message(static_cast<redisReply*>(raw));
+                    // ["message", channel, "<origin> <task id>"]
+                    if (message->type == REDIS_REPLY_ARRAY && message->elements == 3 &&
+                        reply_string(message->element[0]) == "message") {
+                        std::string_view payload = reply_string(message->element[2]);
+                        size_t space = payload.find(' ');
+                        if (space != std::string_view::npos && payload.substr(0, space) != origin_) {
+                            notify(std::string(payload.substr(space + 1)));
+                        }
+                    }
+                    raw = nullptr;
+                }
+                
+                std::lock_guard<std::mutex> lock(subscriber_mutex_);
+                subscriber_fd_ = -1;
+            }
+            
+            std::unique_lock<std::mutex> lock(subscriber_mutex_);
+            if (subscriber_wakeup_.wait_for(lock, SUBSCRIBER_RETRY_DELAY,
+                                            [this] { return subscriber_stopping_; })) {
+                return;
+            }
+        }
+    }
+    
+    void notify(const std::string& task_id) {
+        std::function<void(const std::string&)> on_change;
+        {
+            std::lock_guard<std::mutex> lock(subscriber_mutex_);
+            on_change = on_change_;
+        }
+        on_change(task_id);
+    }
+    
+    static constexpr std::chrono::seconds SUBSCRIBER_RETRY_DELAY{1};
+    
+    std::vector<std::unique_ptr<Connection>> connections_;
+    
+    std::string channel_;
+    std::string origin_;  ///< Tags this instance's announcements so it can skip them
+    
+    std::mutex subscriber_mutex_;
+    std::condition_variable subscriber_wakeup_;
+    std::function<void(const std::string&)> on_change_;
+    int subscriber_fd_ = -1;
+    bool subscriber_stopping_ = false;
+    std::thread subscriber_;
+};
+
+RedisTaskStore::RedisTaskStore(const RedisTaskStoreOptions& options)
+    : impl_(std::make_unique<Impl>(options)) {}
+
+RedisTaskStore::RedisTaskStore(const std::string& host, int port)
+    : impl_(nullptr) {
+    RedisTaskStoreOptions options;
+    options.host = host;
+    options.port = port;
+    impl_ = std::make_unique<Impl>(options);
+}
+
+RedisTaskStore::~RedisTaskStore() = default;
+
+RedisTaskStore::RedisTaskStore(RedisTaskStore&&) noexcept = default;
+RedisTaskStore& RedisTaskStore::operator=(RedisTaskStore&&) noexcept = default;
+
+std::optional<AgentTask> RedisTaskStore::get_task(const std::string& task_id) {
+    return get_task_async(task_id).get();
+}
+
+std::future<std::optional<AgentTask>> RedisTaskStore::get_task_async(const std::string& task_id) {
+    return then(impl_->eval(impl_->get_task_, task_id, {}), [](Reply reply) -> std::optional<AgentTask> {
+        if (reply->type != REDIS_REPLY_ARRAY || reply->elements != 3) {
+            return std::nullopt;
+        }
+        
+        AgentTask task;
+        const redisReply* fields = reply->element[0];
+        for (size_t i = 0; i + 1 < fields->elements; i += 2) {
+            std::string_view field = reply_string(fields->element[i]);
+            std::string_view value = reply_string(fields->element[i + 1]);
+            if (field == "id") {
+                task.set_id(std::string(value));
+            } else if (field == "contextId") {
+                task.set_context_id(std::string(value));
+            } else if (field == "status") {
+                task.set_status(AgentTaskStatus::from_json(value));
+            } else if (field == "metadata") {
+                std::map<std::string, std::string> metadata;
+                JsonReader reader(value);
+                reader.read_string_map(metadata);
+                for (const auto& [key, entry] : metadata) {
+                    task.add_metadata(key, entry);
+                }
+            }
+        }
+        
+        const redisReply* artifacts = reply->element[1];
+        for (size_t i = 0; i < artifacts->elements; ++i) {
+            task.add_artifact(Artifact::from_json(reply_string(artifacts->element[i])));
+        }
+        
+        const redisReply* history = reply->element[2];
+        for (size_t i = 0; i < history->elements; ++i) {
+            task.add_history_message(AgentMessage::from_json(reply_string(history->element[i])));
+        }
+        
+        return task;
+    });
+}
+
+void RedisTaskStore::set_task(const AgentTask& task) {
+    set_task_async(task).get();
+}
+
+std::future<void> RedisTaskStore::set_task_async(const AgentTask& task) {
+    std::string metadata;
+    {
+        JsonWriter writer(metadata);
+        writer.string_map(task.metadata());
+    }
+    
+    const auto& history = task.history();
+    size_t first_message = 0;
+    if (impl_->options_.max_history != 0 && history.size() > impl_->options_.max_history) {
+        first_message = history.size() - impl_->options_.max_history;
+    }
+    
+    std::vector<std::string> args;
+    args.reserve(5 + task.artifacts().size() + history.size() - first_message);
+    args.push_back(task.id());
+    args.push_back(task.context_id());
+    args.push_back(task.status().to_json());
+    args.push_back(std::move(metadata));
+    args.push_back(std::to_string(task.artifacts().size()));
+    for (const auto& artifact : task.artifacts()) {
+        args.push_back(artifact.to_json());
+    }
+    for (size_t i = first_message; i < history.size(); ++i) {
+        args.push_back(history[i].to_json());
+    }
+    
+    return then(impl_->write(impl_->set_task_, task.id(), std::move(args)), [](Reply) {});
+}
+
+void RedisTaskStore::update_status(const std::string& task_id,
+                                   TaskState status,
+                                   const std::string& message) {
+    update_status_async(task_id, status, message).get();
+}
+
+std::future<void> RedisTaskStore::update_status_async(const std::string& task_id,
+                                                      TaskState status,
+                                                      const std::string& message) {
+    AgentTaskStatus new_status(status);
+    if (!message.empty()) {
+        new_status.set_message(message);
+    }
+    
+    return then(impl_->write(impl_->update_status_, task_id, {new_status.to_json()}), [](Reply) {});
+}
+
+void RedisTaskStore::add_artifact(const std::string& task_id,
+                                  const Artifact& artifact) {
+    add_artifact_async(task_id, artifact).get();
+}
+
+std::future<void> RedisTaskStore::add_artifact_async(const std::string& task_id,
+                                                     const Artifact& artifact) {
+    return then(impl_->write(impl_->append_, task_id, {"2", artifact.to_json(), "0"}), [](Reply) {});
+}
+
+void RedisTaskStore::add_history_message(const std::string& task_id,
+                                         const AgentMessage& message) {
+    add_history_message_async(task_id, message).get();
+}
+
+std::future<void> RedisTaskStore::add_history_message_async(const std::string& task_id,
+                                                            const AgentMessage& message) {
+    std::vector<std::string> args = {"3", message.to_json(), std::to_string(impl_->options_.max_history)};
+    return then(impl_->write(impl_->append_, task_id, std::move(args)), [](Reply) {});
+}
+
+std::vector<AgentMessage> RedisTaskStore::get_history(const std::string& context_id,
+                                                      int max_length) {
+    // Only the requested tail is transferred
+    std::string start = max_length > 0 ? std::to_string(-max_length) : "0";
+    Reply reply = checked(impl_->command(context_id, {"LRANGE", impl_->keys(context_id)[2], start, "-1"}).get());
+    
+    std::vector<AgentMessage> history;
+    history.reserve(reply->elements);
+    for (size_t i = 0; i < reply->elements; ++i) {
+        history.push_back(AgentMessage::from_json(reply_string(reply->element[i])));
+    }
+    return history;
+}
+
+bool RedisTaskStore::delete_task(const std::string& task_id) {
+    Reply reply = checked(impl_->write(impl_->delete_task_, task_id, {}).get());
+    return reply->integer > 0;
+}
+
+void RedisTaskStore::subscribe_changes(std::function<void(const std::string& task_id)> on_change) {
+    impl_->subscribe(std::move(on_change));
+}
+
+bool RedisTaskStore::task_exists(const std::string& task_id) {
+    Reply reply = checked(impl_->command(task_id, {"EXISTS", impl_->keys(task_id)[0]}).get());
+    return reply->integer > 0;
+}
+
+} // namespace a2a
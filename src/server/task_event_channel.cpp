@@ -0,0 +1,87 @@
+#include "task_event_channel.hpp"
+
+namespace a2a {
+
+void TaskEventChannel::publish(const std::string& task_id, std::string event_json,
+                               Kind kind, bool final) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    
+    if (kind == Kind::Status && !queue_.empty() &&
+        queue_.back().kind == Kind::Status && !queue_.back().final &&
+        queue_.back().task_id == task_id) {
+        queue_.back().json = std::move(event_json);
+        queue_.back().final = final;
+        not_empty_.notify_one();
+        return;
+    }
+    
+    // The consumer may itself be producing (a handler updating its task
+    // before the stream starts draining); it must never wait on itself
+    if (std::this_thread::get_id() != consumer_ &&
+        !not_full_.wait_for(lock, max_wait_, [this] { return closed_ || queue_.size() < capacity_; })) {
+        // Lagging consumer: end its stream rather than hold up the producer
+        closed_ = true;
+        not_empty_.notify_all();
+        not_full_.notify_all();
+        return;
+    }
+    if (closed_) {
+        return;
+    }
+    
+    queue_.push_back({task_id, std::move(event_json), kind, final});
+    not_empty_.notify_one();
+}
+
+TaskEventChannel::Result TaskEventChannel::next(std::string& task_id, std::string& event_json,
+                                                bool& final, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!not_empty_.wait_for(lock, timeout, [this] { return closed_ || !queue_.empty(); })) {
+        return Result::Timeout;
+    }
+    if (queue_.empty()) {
+        return Result::Closed;
+    }
+    
+    task_id = std::move(queue_.front().task_id);
+    event_json = std::move(queue_.front().json);
+    final = queue_.front().final;
+    queue_.pop_front();
+    not_full_.notify_one();
+    return Result::Event;
+}
+
+bool TaskEventChannel::try_next(std::string& task_id, std::string& event_json, bool& final) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+        return false;
+    }
+    
+    task_id = std::move(queue_.front().task_id);
+    event_json = std::move(queue_.front().json);
+    final = queue_.front().final;
+    queue_.pop_front();
+    not_full_.notify_one();
+    return true;
+}
+
+void TaskEventChannel::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+}
+
+bool TaskEventChannel::add_task(const std::string& task_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.insert(task_id).second;
+}
+
+std::set<std::string> TaskEventChannel::tasks() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_;
+}
+
+} // namespace a2a
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace a2a {
+
+/**
+ * @brief Bounded queue of serialized task events for one stream consumer
+ *
+ * Producers are the threads calling TaskManager::update_status() and
+ * return_artifact(); the consumer is the thread running the stream. When
+ * the consumer falls behind, a status update replaces one of the same task
+ * still waiting at the tail (only the latest state matters). Any other
+ * event waits up to max_wait for room; if the queue is still full, the
+ * consumer is taken to be lagging and the channel is closed, so that one
+ * slow stream never holds up a producer for longer than that.
+ */
+class TaskEventChannel {
+public:
+    enum class Kind {
+        Status,
+        Artifact
+    };
+    
+    enum class Result {
+        Event,
+        Timeout,
+        Closed
+    };
+    
+    TaskEventChannel(size_t capacity, std::chrono::milliseconds max_wait)
+        : capacity_(capacity == 0 ? 1 : capacity)
+        , max_wait_(max_wait)
+        , consumer_(std::this_thread::get_id()) {}
+    
+    /**
+     * @brief Queue an event of a task (dropped once the channel is closed)
+     * Closes the channel instead if it stays full for max_wait.
+     */
+    void publish(const std::string& task_id, std::string event_json, Kind kind, bool final);
+    
+    /**
+     * @brief Wait for the next event
+     * Events queued before the channel closed are still returned first.
+     * @param task_id Set to the task the event belongs to
+     */
+    Result next(std::string& task_id, std::string& event_json, bool& final,
+                std::chrono::milliseconds timeout);
+    
+    /**
+     * @brief Take the next event without waiting
+     */
+    bool try_next(std::string& task_id, std::string& event_json, bool& final);
+    
+    /**
+     * @brief Stop accepting events and wake any blocked producer
+     */
+    void close();
+    
+    /**
+     * @brief Record a task this channel listens to
+     * @return false if it was already recorded
+     */
+    bool add_task(const std::string& task_id);
+    
+    std::set<std::string> tasks();
+
+private:
+    struct Event {
+        std::string task_id;
+        std::string json;
+        Kind kind;
+        bool final;
+    };
+    
+    size_t capacity_;
+    std::chrono::milliseconds max_wait_;
+    std::thread::id consumer_;
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<Event> queue_;
+    std::set<std::string> tasks_;
+    bool closed_ = false;
+};
+
+} // namespace a2a
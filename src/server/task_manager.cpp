@@ -1,25 +1,39 @@
 #include <a2a/server/task_manager.hpp>
 #include <a2a/server/memory_task_store.hpp>
+#include <a2a/models/task_events.hpp>
 #include <a2a/core/exception.hpp>
-#include <sstream>
+#include <a2a/core/id_generator.hpp>
+#include "task_event_channel.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace a2a {
 
-// Helper to generate UUID (simplified)
-static std::string generate_task_id() {
-    static int counter = 0;
-    std::ostringstream oss;
-    oss << "task-" << ++counter << "-" << std::time(nullptr);
-    return oss.str();
-}
+namespace {
+
+// The agent URL comes from the client's Host header, so the number of
+// cached cards is bounded
+constexpr size_t MAX_CACHED_AGENT_CARDS = 16;
 
-static std::string generate_context_id() {
-    static int counter = 0;
-    std::ostringstream oss;
-    oss << "ctx-" << ++counter << "-" << std::time(nullptr);
-    return oss.str();
+// Strong entity tag: 64-bit FNV-1a of the representation
+std::string entity_tag(std::string_view data) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : data) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    char tag[24];
+    std::snprintf(tag, sizeof(tag), "\"%016llx\"", static_cast<unsigned long long>(hash));
+    return tag;
 }
 
+} // namespace
+
 // PIMPL implementation
 class TaskManager::Impl {
 public:
@@ -33,12 +47,168 @@ public:
     
     std::shared_ptr<ITaskStore> task_store_;
     MessageCallback on_message_received_;
+    MessageViewCallback on_message_view_received_;
     TaskCallback on_task_created_;
     TaskCallback on_task_cancelled_;
     TaskCallback on_task_updated_;
     AgentCardCallback on_agent_card_query_;
+    TaskStreamOptions stream_options_;
+    
+    // Serialized agent cards by agent URL
+    std::shared_mutex cards_mutex_;
+    std::unordered_map<std::string, std::shared_ptr<const AgentCardDocument>> cards_;
+    uint64_t cards_generation_ = 0;  ///< Bumped by invalidate_agent_card()
+    
+    /**
+     * @brief Stream being started on this thread; tasks created while it is
+     * set are attached to its channel
+     */
+    struct StreamScope {
+        Impl* owner;
+        std::shared_ptr<TaskEventChannel> channel;
+    };
+    
+    static thread_local const StreamScope* current_stream_;
+    
+    /**
+     * @brief Detaches a channel from every task when the stream ends
+     */
+    class Subscription {
+    public:
+        Subscription(Impl& impl, std::shared_ptr<TaskEventChannel> channel)
+            : impl_(impl), channel_(std::move(channel)) {}
+        ~Subscription() { impl_.unsubscribe(channel_); }
+        
+        Subscription(const Subscription&) = delete;
+        Subscription& operator=(const Subscription&) = delete;
+    
+    private:
+        Impl& impl_;
+        std::shared_ptr<TaskEventChannel> channel_;
+    };
+    
+    void subscribe(const std::string& task_id, const std::shared_ptr<TaskEventChannel>& channel) {
+        if (!channel->add_task(task_id)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(streams_mutex_);
+        streams_[task_id].push_back(channel);
+    }
+    
+    void unsubscribe(const std::shared_ptr<TaskEventChannel>& channel) {
+        channel->close();
+        
+        std::lock_guard<std::mutex> lock(streams_mutex_);
+        for (const auto& task_id : channel->tasks()) {
+            auto it = streams_.find(task_id);
+            if (it == streams_.end()) {
+                continue;
+            }
+            auto& channels = it->second;
+            channels.erase(std::remove_if(channels.begin(), channels.end(),
+                                          [&channel](const std::weak_ptr<TaskEventChannel>& weak) {
+                                              auto live = weak.lock();
+                                              return !live || live == channel;
+                                          }),
+                           channels.end());
+            if (channels.empty()) {
+                streams_.erase(it);
+            }
+        }
+    }
+    
+    bool has_subscribers(const std::string& task_id) {
+        std::lock_guard<std::mutex> lock(streams_mutex_);
+        return streams_.count(task_id) != 0;
+    }
+    
+    // Deliver outside the lock: a full channel may hold its producer for
+    // up to max_publish_wait
+    void publish(const std::string& task_id, const std::string& event_json,
+                 TaskEventChannel::Kind kind, bool final) {
+        std::vector<std::shared_ptr<TaskEventChannel>> targets;
+        {
+            std::lock_guard<std::mutex> lock(streams_mutex_);
+            auto it = streams_.find(task_id);
+            if (it == streams_.end()) {
+                return;
+            }
+            for (const auto& weak : it->second) {
+                if (auto channel = weak.lock()) {
+                    targets.push_back(std::move(channel));
+                }
+            }
+        }
+        
+        for (const auto& channel : targets) {
+            channel->publish(task_id, event_json, kind, final);
+        }
+    }
+    
+    void publish_status(const AgentTask& task) {
+        bool final = task.is_terminal();
+        TaskStatusUpdateEvent event(task.id(), task.context_id(), task.status(), final);
+        publish(task.id(), event.to_json(), TaskEventChannel::Kind::Status, final);
+    }
+    
+    /**
+     * @brief Forward the channel's queued events to callback until the
+     * followed task's final one
+     *
+     * The channel may also carry events of other tasks (ones the message
+     * referenced or the handler created); those are forwarded but do not
+     * end the stream.
+     * @param task_id Task the stream follows
+     * @param callback Consumer callback
+     * @param channel Channel subscribed to the task
+     */
+    void pump(const std::string& task_id,
+              const std::function<void(const std::string&)>& callback,
+              TaskEventChannel& channel) {
+        std::string event_task_id;
+        std::string event;
+        bool final = false;
+        
+        // Finished before (or while) the stream was set up: flush what is
+        // queued, then make sure the stream still ends with a final event
+        auto current = task_store_->get_task_snapshot(task_id);
+        if (!current || current->is_terminal()) {
+            while (channel.try_next(event_task_id, event, final)) {
+                callback(event);
+                if (final && event_task_id == task_id) {
+                    return;
+                }
+            }
+            if (current) {
+                callback(TaskStatusUpdateEvent(task_id, current->context_id(),
+                                               current->status(), true).to_json());
+            }
+            return;
+        }
+        
+        for (;;) {
+            auto result = channel.next(event_task_id, event, final, stream_options_.heartbeat_interval);
+            if (result == TaskEventChannel::Result::Closed) {
+                return;
+            }
+            if (result == TaskEventChannel::Result::Timeout) {
+                callback(std::string());
+                continue;
+            }
+            callback(event);
+            if (final && event_task_id == task_id) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::mutex streams_mutex_;
+    std::unordered_map<std::string, std::vector<std::weak_ptr<TaskEventChannel>>> streams_;
 };
 
+thread_local const TaskManager::Impl::StreamScope* TaskManager::Impl::current_stream_ = nullptr;
+
 TaskManager::TaskManager(std::shared_ptr<ITaskStore> task_store)
     : impl_(std::make_unique<Impl>(task_store)) {}
 
@@ -51,6 +221,10 @@ void TaskManager::set_on_message_received(MessageCallback callback) {
     impl_->on_message_received_ = std::move(callback);
 }
 
+void TaskManager::set_on_message_view_received(MessageViewCallback callback) {
+    impl_->on_message_view_received_ = std::move(callback);
+}
+
 void TaskManager::set_on_task_created(TaskCallback callback) {
     impl_->on_task_created_ = std::move(callback);
 }
@@ -65,16 +239,33 @@ void TaskManager::set_on_task_updated(TaskCallback callback) {
 
 void TaskManager::set_on_agent_card_query(AgentCardCallback callback) {
     impl_->on_agent_card_query_ = std::move(callback);
+    invalidate_agent_card();
+}
+
+void TaskManager::invalidate_agent_card() {
+    std::unique_lock<std::shared_mutex> lock(impl_->cards_mutex_);
+    impl_->cards_.clear();
+    ++impl_->cards_generation_;
+}
+
+void TaskManager::set_stream_options(const TaskStreamOptions& options) {
+    impl_->stream_options_ = options;
 }
 
 AgentTask TaskManager::create_task(const std::string& context_id,
                                    const std::string& task_id) {
-    std::string actual_context_id = context_id.empty() ? generate_context_id() : context_id;
-    std::string actual_task_id = task_id.empty() ? generate_task_id() : task_id;
+    std::string actual_context_id = context_id.empty() ? generate_id() : context_id;
+    std::string actual_task_id = task_id.empty() ? generate_id() : task_id;
     
     AgentTask task(actual_task_id, actual_context_id);
     task.set_status(TaskState::Submitted);
     
+    // A handler creating its task while a stream starts feeds that stream
+    const Impl::StreamScope* scope = Impl::current_stream_;
+    if (scope && scope->owner == impl_.get()) {
+        impl_->subscribe(actual_task_id, scope->channel);
+    }
+    
     // Store task
     impl_->task_store_->set_task(task);
     
@@ -87,26 +278,24 @@ AgentTask TaskManager::create_task(const std::string& context_id,
 }
 
 AgentTask TaskManager::get_task(const std::string& task_id) {
-    auto task_opt = impl_->task_store_->get_task(task_id);
+    return *get_task_snapshot(task_id);
+}
+
+std::shared_ptr<const AgentTask> TaskManager::get_task_snapshot(const std::string& task_id) {
+    auto task = impl_->task_store_->get_task_snapshot(task_id);
     
-    if (!task_opt.has_value()) {
+    if (!task) {
         throw A2AException("Task not found: " + task_id, ErrorCode::TaskNotFound);
     }
     
-    return *task_opt;
+    return task;
 }
 
 AgentTask TaskManager::cancel_task(const std::string& task_id) {
-    auto task_opt = impl_->task_store_->get_task(task_id);
-    
-    if (!task_opt.has_value()) {
-        throw A2AException("Task not found: " + task_id, ErrorCode::TaskNotFound);
-    }
-    
-    AgentTask task = *task_opt;
+    auto task = get_task_snapshot(task_id);
     
     // Check if task can be cancelled
-    if (task.is_terminal()) {
+    if (task->is_terminal()) {
         throw A2AException(
             "Task is in terminal state and cannot be cancelled",
             ErrorCode::TaskNotCancelable
@@ -117,14 +306,18 @@ AgentTask TaskManager::cancel_task(const std::string& task_id) {
     impl_->task_store_->update_status(task_id, TaskState::Canceled);
     
     // Get updated task
-    task = *impl_->task_store_->get_task(task_id);
+    task = get_task_snapshot(task_id);
+    
+    if (impl_->has_subscribers(task_id)) {
+        impl_->publish_status(*task);
+    }
     
     // Call callback
     if (impl_->on_task_cancelled_) {
-        impl_->on_task_cancelled_(task);
+        impl_->on_task_cancelled_(*task);
     }
     
-    return task;
+    return *task;
 }
 
 void TaskManager::update_status(const std::string& task_id,
@@ -137,10 +330,13 @@ void TaskManager::update_status(const std::string& task_id,
     
     impl_->task_store_->update_status(task_id, status, msg_text);
     
-    // Get updated task and call callback
-    auto task_opt = impl_->task_store_->get_task(task_id);
-    if (task_opt.has_value() && impl_->on_task_updated_) {
-        impl_->on_task_updated_(*task_opt);
+    // Get updated task (a shared snapshot, not a copy) and call callback
+    auto task = impl_->task_store_->get_task_snapshot(task_id);
+    if (task && impl_->has_subscribers(task_id)) {
+        impl_->publish_status(*task);
+    }
+    if (task && impl_->on_task_updated_) {
+        impl_->on_task_updated_(*task);
     }
 }
 
@@ -148,10 +344,14 @@ void TaskManager::return_artifact(const std::string& task_id,
                                  const Artifact& artifact) {
     impl_->task_store_->add_artifact(task_id, artifact);
     
-    // Get updated task and call callback
-    auto task_opt = impl_->task_store_->get_task(task_id);
-    if (task_opt.has_value() && impl_->on_task_updated_) {
-        impl_->on_task_updated_(*task_opt);
+    // Get updated task (a shared snapshot, not a copy) and call callback
+    auto task = impl_->task_store_->get_task_snapshot(task_id);
+    if (task && impl_->has_subscribers(task_id)) {
+        TaskArtifactUpdateEvent event(task_id, task->context_id(), artifact);
+        impl_->publish(task_id, event.to_json(), TaskEventChannel::Kind::Artifact, false);
+    }
+    if (task && impl_->on_task_updated_) {
+        impl_->on_task_updated_(*task);
     }
 }
 
@@ -168,8 +368,7 @@ A2AResponse TaskManager::send_message(const MessageSendParams& params) {
         // Update existing task
         const std::string& task_id = *params.message().task_id();
         
-        auto task_opt = impl_->task_store_->get_task(task_id);
-        if (!task_opt.has_value()) {
+        if (!impl_->task_store_->task_exists(task_id)) {
             throw A2AException("Task not found: " + task_id, ErrorCode::TaskNotFound);
         }
         
@@ -181,6 +380,27 @@ A2AResponse TaskManager::send_message(const MessageSendParams& params) {
     return impl_->on_message_received_(params);
 }
 
+A2AResponse TaskManager::send_message(const MessageSendParamsView& params,
+                                      std::pmr::memory_resource* resource) {
+    if (!impl_->on_message_view_received_) {
+        return send_message(params.to_params(resource));
+    }
+    
+    const AgentMessageView& message = params.message();
+    if (message.task_id().has_value()) {
+        const std::string& task_id = *message.task_id();
+        
+        if (!impl_->task_store_->task_exists(task_id)) {
+            throw A2AException("Task not found: " + task_id, ErrorCode::TaskNotFound);
+        }
+        
+        // History keeps the full message, so only this path decodes it
+        impl_->task_store_->add_history_message(task_id, message.to_message(resource));
+    }
+    
+    return impl_->on_message_view_received_(params);
+}
+
 void TaskManager::send_message_streaming(const MessageSendParams& params,
                                         std::function<void(const std::string&)> callback) {
     if (!impl_->on_message_received_) {
@@ -190,20 +410,50 @@ void TaskManager::send_message_streaming(const MessageSendParams& params,
         );
     }
     
-    // For streaming, we would need to:
-    // 1. Create or get task
-    // 2. Call user callback
-    // 3. Stream events as they occur
-    // This is a simplified implementation
+    auto channel = std::make_shared<TaskEventChannel>(impl_->stream_options_.max_queued_events,
+                                                      impl_->stream_options_.max_publish_wait);
+    Impl::Subscription subscription(*impl_, channel);
+    
+    if (params.message().task_id().has_value()) {
+        impl_->subscribe(*params.message().task_id(), channel);
+    }
+    
+    // Run the handler with this stream as the thread's current one, so
+    // events it triggers synchronously are queued rather than lost
+    Impl::StreamScope scope{impl_.get(), channel};
+    const Impl::StreamScope* previous = Impl::current_stream_;
+    Impl::current_stream_ = &scope;
     
-    auto response = impl_->on_message_received_(params);
+    std::optional<A2AResponse> response;
+    try {
+        response.emplace(send_message(params));
+    } catch (...) {
+        Impl::current_stream_ = previous;
+        throw;
+    }
+    Impl::current_stream_ = previous;
     
-    // Send response as event
-    if (response.is_task()) {
-        callback(response.as_task().to_json());
-    } else {
-        callback(response.as_message().to_json());
+    if (response->is_message()) {
+        callback(response->as_message().to_json());
+        return;
     }
+    
+    const AgentTask& task = response->as_task();
+    impl_->subscribe(task.id(), channel);
+    callback(task.to_json());
+    impl_->pump(task.id(), callback, *channel);
+}
+
+void TaskManager::resubscribe(const std::string& task_id,
+                              std::function<void(const std::string&)> callback) {
+    auto channel = std::make_shared<TaskEventChannel>(impl_->stream_options_.max_queued_events,
+                                                      impl_->stream_options_.max_publish_wait);
+    Impl::Subscription subscription(*impl_, channel);
+    
+    // Subscribe first so no update between the snapshot and the stream is lost
+    impl_->subscribe(task_id, channel);
+    callback(get_task_snapshot(task_id)->to_json());
+    impl_->pump(task_id, callback, *channel);
 }
 
 AgentCard TaskManager::get_agent_card(const std::string& agent_url) {
@@ -219,6 +469,34 @@ AgentCard TaskManager::get_agent_card(const std::string& agent_url) {
     return impl_->on_agent_card_query_(agent_url);
 }
 
+std::shared_ptr<const AgentCardDocument> TaskManager::get_agent_card_document(const std::string& agent_url) {
+    uint64_t generation;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl_->cards_mutex_);
+        auto it = impl_->cards_.find(agent_url);
+        if (it != impl_->cards_.end()) {
+            return it->second;
+        }
+        generation = impl_->cards_generation_;
+    }
+    
+    // Built outside the lock; concurrent misses build the same document
+    auto document = std::make_shared<AgentCardDocument>();
+    document->json = get_agent_card(agent_url).to_json();
+    document->etag = entity_tag(document->json);
+    
+    std::unique_lock<std::shared_mutex> lock(impl_->cards_mutex_);
+    if (generation != impl_->cards_generation_) {
+        // Invalidated meanwhile; serve it once but do not cache it
+        return document;
+    }
+    if (impl_->cards_.size() >= MAX_CACHED_AGENT_CARDS) {
+        impl_->cards_.clear();
+    }
+    impl_->cards_[agent_url] = document;
+    return document;
+}
+
 std::shared_ptr<ITaskStore> TaskManager::get_task_store() const {
     return impl_->task_store_;
 }
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <a2a/models/agent_task.hpp>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace a2a {
+namespace server {
+
+// Rough heap footprint of tasks, for stores that bound their memory.
+// Counts payload bytes plus a fixed allowance per object; allocator
+// overhead and small-string buffers are not modelled.
+
+constexpr size_t NODE_OVERHEAD = 64;
+
+inline size_t approximate_size(const std::optional<std::string>& value) {
+    return value ? value->size() : 0;
+}
+
+inline size_t approximate_size(const std::map<std::string, std::string>& map) {
+    size_t size = 0;
+    for (const auto& [key, value] : map) {
+        size += NODE_OVERHEAD + key.size() + value.size();
+    }
+    return size;
+}
+
+inline size_t approximate_size(const AgentMessage& message) {
+    size_t size = sizeof(AgentMessage) + message.message_id().size() +
+                  approximate_size(message.context_id()) + approximate_size(message.task_id());
+    for (const auto& part : message.parts()) {
+        size += sizeof(MessagePart);
+        if (const auto* text = part.get_if<TextPart>()) {
+            size += text->text().size();
+        } else if (const auto* file = part.get_if<FilePart>()) {
+            size += file->filename().size() + file->mime_type().size() + file->data().size();
+        } else if (const auto* data = part.get_if<DataPart>()) {
+            size += data->data_json().size();
+        }
+    }
+    return size;
+}
+
+inline size_t approximate_size(const Artifact& artifact) {
+    return sizeof(Artifact) + artifact.id().size() + artifact.name().size() +
+           approximate_size(artifact.description()) + approximate_size(artifact.mime_type()) +
+           approximate_size(artifact.url()) + approximate_size(artifact.content()) +
+           approximate_size(artifact.metadata());
+}
+
+inline size_t approximate_size(const AgentTask& task) {
+    size_t size = sizeof(AgentTask) + task.id().size() + task.context_id().size() +
+                  task.status().message().size() + approximate_size(task.metadata());
+    for (const auto& artifact : task.artifacts()) {
+        size += approximate_size(artifact);
+    }
+    for (const auto& message : task.history()) {
+        size += approximate_size(message);
+    }
+    return size;
+}
+
+} // namespace server
+} // namespace a2a
@@ -0,0 +1,137 @@
+#include "thread_pool.hpp"
+
+namespace a2a {
+namespace server {
+
+ThreadPool::ThreadPool(size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 4;
+    }
+    
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this] { run(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+}
+
+void ThreadPool::run() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+            if (jobs_.empty()) {
+                return;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        job();
+    }
+}
+
+GrowingThreadPool::GrowingThreadPool(std::chrono::milliseconds idle_timeout)
+    : idle_timeout_(idle_timeout) {}
+
+GrowingThreadPool::~GrowingThreadPool() {
+    std::map<std::thread::id, std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    
+    // A job finishing up may still submit another, which starts a thread;
+    // keep joining until none is left
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (threads_.empty()) {
+                break;
+            }
+            threads.swap(threads_);
+        }
+        for (auto& entry : threads) {
+            entry.second.join();
+        }
+        threads.clear();
+    }
+}
+
+void GrowingThreadPool::submit(std::function<void()> job) {
+    std::vector<std::thread> exited;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+        
+        for (std::thread::id id : exited_) {
+            auto it = threads_.find(id);
+            exited.push_back(std::move(it->second));
+            threads_.erase(it);
+        }
+        exited_.clear();
+        
+        if (jobs_.size() > idle_) {
+            std::thread thread([this] { run(); });
+            std::thread::id id = thread.get_id();
+            threads_.emplace(id, std::move(thread));
+        }
+    }
+    cv_.notify_one();
+    
+    for (auto& thread : exited) {
+        thread.join();
+    }
+}
+
+size_t GrowingThreadPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return threads_.size() - exited_.size();
+}
+
+void GrowingThreadPool::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        ++idle_;
+        cv_.wait_for(lock, idle_timeout_, [this] { return stopping_ || !jobs_.empty(); });
+        --idle_;
+        if (jobs_.empty()) {
+            // Stopping, or idle too long; whoever submits next joins us
+            if (!stopping_) {
+                exited_.push_back(std::this_thread::get_id());
+            }
+            return;
+        }
+        
+        std::function<void()> job = std::move(jobs_.front());
+        jobs_.pop_front();
+        lock.unlock();
+        job();
+        lock.lock();
+    }
+}
+
+} // namespace server
+} // namespace a2a
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace a2a {
+namespace server {
+
+/**
+ * @brief Fixed-size worker pool with a FIFO job queue
+ */
+class ThreadPool {
+public:
+    /**
+     * @param threads Number of workers (0 = hardware concurrency)
+     */
+    explicit ThreadPool(size_t threads);
+    
+    /**
+     * @brief Runs queued jobs to completion, then joins the workers
+     */
+    ~ThreadPool();
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    void submit(std::function<void()> job);
+    
+    size_t size() const { return workers_.size(); }
+
+private:
+    void run();
+    
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> jobs_;
+    bool stopping_ = false;
+};
+
+/**
+ * @brief Pool that grows so that no job waits for another
+ *
+ * A job runs on an idle thread if there is one and on a new thread
+ * otherwise. Threads left idle for idle_timeout exit. Meant for jobs that
+ * run for a long time, such as response streams, which would starve a
+ * fixed pool.
+ */
+class GrowingThreadPool {
+public:
+    explicit GrowingThreadPool(std::chrono::milliseconds idle_timeout = std::chrono::seconds(30));
+    
+    /**
+     * @brief Runs queued jobs to completion, then joins the threads
+     */
+    ~GrowingThreadPool();
+    
+    GrowingThreadPool(const GrowingThreadPool&) = delete;
+    GrowingThreadPool& operator=(const GrowingThreadPool&) = delete;
+    
+    void submit(std::function<void()> job);
+    
+    /**
+     * @brief Threads currently alive, busy or idle
+     */
+    size_t size() const;
+
+private:
+    void run();
+    
+    std::chrono::milliseconds idle_timeout_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> jobs_;
+    std::map<std::thread::id, std::thread> threads_;
+    std::vector<std::thread::id> exited_;   // idle threads that timed out, to join
+    size_t idle_ = 0;
+    bool stopping_ = false;
+};
+
+} // namespace server
+} // namespace a2a
@@ -0,0 +1,79 @@
+#include <a2a/core/base64.hpp>
+#include <a2a/core/exception.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace a2a;
+
+namespace {
+
+std::string reference_encode(const std::vector<uint8_t>& data) {
+    static const char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < data.size(); i += 3) {
+        uint32_t n = static_cast<uint32_t>(data[i]) << 16;
+        if (i + 1 < data.size()) n |= static_cast<uint32_t>(data[i + 1]) << 8;
+        if (i + 2 < data.size()) n |= data[i + 2];
+        out += alphabet[(n >> 18) & 63];
+        out += alphabet[(n >> 12) & 63];
+        out += i + 1 < data.size() ? alphabet[(n >> 6) & 63] : '=';
+        out += i + 2 < data.size() ? alphabet[n & 63] : '=';
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(Base64Test, KnownVectors) {
+    auto encode = [](const std::string& s) {
+        return base64_encode(std::vector<uint8_t>(s.begin(), s.end()));
+    };
+    EXPECT_EQ(encode(""), "");
+    EXPECT_EQ(encode("f"), "Zg==");
+    EXPECT_EQ(encode("fo"), "Zm8=");
+    EXPECT_EQ(encode("foo"), "Zm9v");
+    EXPECT_EQ(encode("foobar"), "Zm9vYmFy");
+}
+
+// Covers the SIMD blocks and every tail length
+TEST(Base64Test, RoundTripsEveryLength) {
+    std::mt19937 rng(42);
+    for (size_t size = 0; size <= 300; ++size) {
+        std::vector<uint8_t> data(size);
+        for (auto& byte : data) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        std::string encoded = base64_encode(data);
+        ASSERT_EQ(encoded, reference_encode(data)) << "size " << size;
+        ASSERT_EQ(encoded.size(), base64_encoded_size(size));
+        ASSERT_EQ(base64_decode(encoded), data) << "size " << size;
+    }
+}
+
+TEST(Base64Test, DecodesWithoutPaddingAndWithWhitespace) {
+    EXPECT_EQ(base64_decode("Zm8"), (std::vector<uint8_t>{'f', 'o'}));
+    EXPECT_EQ(base64_decode("Zm9v\r\nYmFy\n"), (std::vector<uint8_t>{'f', 'o', 'o', 'b', 'a', 'r'}));
+    
+    std::vector<uint8_t> data(200, 0xAB);
+    std::string wrapped = base64_encode(data);
+    for (size_t at = 76; at < wrapped.size(); at += 78) {
+        wrapped.insert(at, "\r\n");
+    }
+    EXPECT_EQ(base64_decode(wrapped), data);
+}
+
+TEST(Base64Test, RejectsMalformedInput) {
+    std::vector<std::string> inputs = {"Zm9v$mFy", "Z", "Zm9vY", "Zm=v", "Zm9v====",
+                                       std::string(64, 'A') + "*"};
+    for (const auto& text : inputs) {
+        try {
+            base64_decode(text);
+            ADD_FAILURE() << "no error for " << text;
+        } catch (const A2AException& e) {
+            EXPECT_EQ(e.error_code(), ErrorCode::ParseError) << text;
+        }
+    }
+}
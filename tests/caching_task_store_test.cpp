@@ -0,0 +1,122 @@
+#include <a2a/server/caching_task_store.hpp>
+#include <a2a/server/memory_task_store.hpp>
+#include <a2a/core/exception.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+
+using namespace a2a;
+
+namespace {
+
+AgentMessage text_message(const std::string& text) {
+    return AgentMessage::create().with_role(MessageRole::User).with_text(text);
+}
+
+// Backing store that counts reads and can be made to fail writes
+class CountingStore : public MemoryTaskStore {
+public:
+    std::optional<AgentTask> get_task(const std::string& task_id) override {
+        ++reads;
+        return MemoryTaskStore::get_task(task_id);
+    }
+    
+    void update_status(const std::string& task_id, TaskState status,
+                       const std::string& message = "") override {
+        if (fail_writes) {
+            throw A2AException("backing store down", ErrorCode::InternalError);
+        }
+        MemoryTaskStore::update_status(task_id, status, message);
+    }
+    
+    std::atomic<int> reads{0};
+    bool fail_writes = false;
+};
+
+} // namespace
+
+TEST(CachingTaskStoreTest, ServesRepeatedReadsFromMemory) {
+    auto backing = std::make_shared<CountingStore>();
+    backing->set_task(AgentTask("t", "c"));
+    CachingTaskStore cache(backing);
+    
+    ASSERT_TRUE(cache.get_task("t").has_value());
+    ASSERT_TRUE(cache.get_task_snapshot("t"));
+    ASSERT_TRUE(cache.get_task("t").has_value());
+    EXPECT_EQ(backing->reads.load(), 1);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(CachingTaskStoreTest, WritesThroughToBothCopies) {
+    auto backing = std::make_shared<CountingStore>();
+    CachingTaskStore cache(backing);
+    cache.set_task(AgentTask("t", "c"));
+    auto before = cache.get_task_snapshot("t");
+    
+    cache.update_status("t", TaskState::Running);
+    cache.add_artifact("t", Artifact("a", "result"));
+    cache.add_history_message("t", text_message("hello"));
+    
+    auto cached = cache.get_task_snapshot("t");
+    auto stored = backing->get_task_snapshot("t");
+    EXPECT_EQ(cached->to_json(), stored->to_json());
+    EXPECT_EQ(cached->history().size(), 1u);
+    EXPECT_EQ(backing->reads.load(), 0);
+    
+    // Copy-on-write: an earlier snapshot is untouched
+    EXPECT_EQ(before->status().state(), TaskState::Submitted);
+    EXPECT_TRUE(before->artifacts().empty());
+}
+
+TEST(CachingTaskStoreTest, InvalidateReloadsExternalChanges) {
+    auto backing = std::make_shared<CountingStore>();
+    backing->set_task(AgentTask("t", "c"));
+    CachingTaskStore cache(backing);
+    ASSERT_TRUE(cache.get_task("t"));
+    
+    backing->update_status("t", TaskState::Completed);  // another process
+    EXPECT_EQ(cache.get_task("t")->status().state(), TaskState::Submitted);
+    
+    cache.invalidate("t");
+    EXPECT_EQ(cache.get_task("t")->status().state(), TaskState::Completed);
+    EXPECT_EQ(backing->reads.load(), 2);
+}
+
+TEST(CachingTaskStoreTest, FailedWriteDropsCachedCopy) {
+    auto backing = std::make_shared<CountingStore>();
+    CachingTaskStore cache(backing);
+    cache.set_task(AgentTask("t", "c"));
+    
+    backing->fail_writes = true;
+    EXPECT_THROW(cache.update_status("t", TaskState::Running), A2AException);
+    EXPECT_EQ(cache.size(), 0u);
+    
+    backing->fail_writes = false;
+    EXPECT_EQ(cache.get_task("t")->status().state(), TaskState::Submitted);
+}
+
+TEST(CachingTaskStoreTest, StaysWithinByteBudget) {
+    CachingTaskStoreOptions options;
+    options.max_bytes = 32 * 1024;
+    CachingTaskStore cache(std::make_shared<MemoryTaskStore>(), options);
+    
+    for (int i = 0; i < 100; ++i) {
+        std::string id = "t" + std::to_string(i);
+        cache.set_task(AgentTask(id, "c"));
+        cache.add_history_message(id, text_message(std::string(1024, 'x')));
+        ASSERT_LE(cache.bytes(), options.max_bytes);
+    }
+    // Evicted tasks are still in the backing store
+    EXPECT_LT(cache.size(), 100u);
+    EXPECT_TRUE(cache.get_task("t0").has_value());
+}
+
+TEST(CachingTaskStoreTest, DeleteRemovesFromBoth) {
+    auto backing = std::make_shared<CountingStore>();
+    CachingTaskStore cache(backing);
+    cache.set_task(AgentTask("t", "c"));
+    
+    EXPECT_TRUE(cache.delete_task("t"));
+    EXPECT_FALSE(cache.task_exists("t"));
+    EXPECT_FALSE(backing->task_exists("t"));
+}
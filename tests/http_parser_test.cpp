@@ -0,0 +1,144 @@
+#include "server/http_parser.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace a2a;
+using server::HttpRequest;
+using server::HttpRequestParser;
+
+namespace {
+
+constexpr size_t kMaxHeader = 8192;
+constexpr size_t kMaxBody = 1 << 20;
+
+struct Parsed {
+    std::vector<HttpRequest> requests;
+    int error = 0;
+};
+
+// Feed input in pieces of @p step bytes, collecting every request
+Parsed parse(const std::string& input, size_t step = 0) {
+    HttpRequestParser parser(kMaxHeader, kMaxBody);
+    Parsed parsed;
+    if (step == 0) {
+        step = input.size();
+    }
+    
+    std::string pending;
+    for (size_t at = 0; at < input.size(); at += step) {
+        pending += input.substr(at, step);
+        size_t offset = 0;
+        while (offset < pending.size()) {
+            size_t consumed = 0;
+            auto status = parser.parse(pending.data() + offset, pending.size() - offset, consumed);
+            offset += consumed;
+            if (status == HttpRequestParser::Status::Error) {
+                parsed.error = parser.error_status();
+                return parsed;
+            }
+            if (status == HttpRequestParser::Status::Incomplete) {
+                break;
+            }
+            parsed.requests.push_back(std::move(parser.request()));
+            parser.reset();
+        }
+        pending.erase(0, offset);
+    }
+    return parsed;
+}
+
+} // namespace
+
+TEST(HttpParserTest, ParsesContentLengthRequest) {
+    std::string input = "POST /rpc?x=1 HTTP/1.1\r\nHost: a\r\nContent-Type: application/json\r\n"
+                        "Content-Length: 5\r\n\r\nhello";
+    for (size_t step : {0, 1, 2, 3, 7}) {
+        Parsed parsed = parse(input, step);
+        ASSERT_EQ(parsed.error, 0) << "step " << step;
+        ASSERT_EQ(parsed.requests.size(), 1u) << "step " << step;
+        const HttpRequest& request = parsed.requests[0];
+        EXPECT_EQ(request.method, "POST");
+        EXPECT_EQ(request.path, "/rpc");
+        EXPECT_EQ(request.query, "x=1");
+        EXPECT_EQ(request.header("content-type"), "application/json");
+        EXPECT_EQ(request.body, "hello");
+        EXPECT_TRUE(request.keep_alive());
+    }
+}
+
+TEST(HttpParserTest, DecodesChunkedBody) {
+    std::string input = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+                        "5\r\nhello\r\n6;ext=1\r\n world\r\n0\r\nTrailer: x\r\n\r\n";
+    for (size_t step : {0, 1, 4}) {
+        Parsed parsed = parse(input, step);
+        ASSERT_EQ(parsed.error, 0);
+        ASSERT_EQ(parsed.requests.size(), 1u);
+        EXPECT_EQ(parsed.requests[0].body, "hello world");
+    }
+}
+
+TEST(HttpParserTest, ParsesPipelinedRequests) {
+    std::string input = "POST /a HTTP/1.1\r\nContent-Length: 3\r\n\r\nabc"
+                        "GET /b HTTP/1.1\r\n\r\n"
+                        "\r\nGET /c HTTP/1.0\r\nConnection: keep-alive\r\n\r\n";
+    Parsed parsed = parse(input);
+    ASSERT_EQ(parsed.requests.size(), 3u);
+    EXPECT_EQ(parsed.requests[0].body, "abc");
+    EXPECT_EQ(parsed.requests[1].path, "/b");
+    EXPECT_EQ(parsed.requests[2].path, "/c");
+    EXPECT_TRUE(parsed.requests[2].keep_alive());
+}
+
+TEST(HttpParserTest, BareLfHeadEndsAtFirstBlankLine) {
+    // The body contains CRLFCRLF, which must not be taken for the head's end
+    std::string input = "POST /len HTTP/1.1\nHost: x\nContent-Length: 8\n\nab\r\n\r\ncd";
+    for (size_t step : {0, 1, 5}) {
+        Parsed parsed = parse(input, step);
+        ASSERT_EQ(parsed.error, 0);
+        ASSERT_EQ(parsed.requests.size(), 1u);
+        EXPECT_EQ(parsed.requests[0].header("content-length"), "8");
+        EXPECT_EQ(parsed.requests[0].body, "ab\r\n\r\ncd");
+    }
+}
+
+TEST(HttpParserTest, MergesRepeatedHeaders) {
+    Parsed parsed = parse("GET / HTTP/1.1\r\nAccept: a\r\naccept: b\r\n\r\n");
+    ASSERT_EQ(parsed.requests.size(), 1u);
+    EXPECT_EQ(parsed.requests[0].header("accept"), "a, b");
+}
+
+TEST(HttpParserTest, RejectsMalformedRequests) {
+    struct Case {
+        const char* input;
+        int status;
+    };
+    for (const Case& c : {
+             Case{"GARBAGE\r\n\r\n", 400},
+             Case{"GET / HTTP/1.1\r\nNo colon\r\n\r\n", 400},
+             Case{"GET / HTTP/1.1\r\nA: 1\r\n folded\r\n\r\n", 400},
+             Case{"POST / HTTP/1.1\r\nContent-Length: 12x\r\n\r\n", 400},
+             Case{"POST / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n", 501},
+             Case{"POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n", 400},
+             // Both framings at once is the request-smuggling pattern
+             Case{"POST / HTTP/1.1\r\nContent-Length: 5\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\r\n", 400},
+         }) {
+        EXPECT_EQ(parse(c.input).error, c.status) << c.input;
+    }
+}
+
+TEST(HttpParserTest, EnforcesLimits) {
+    std::string big_head = "GET / HTTP/1.1\r\nX: " + std::string(kMaxHeader, 'a') + "\r\n\r\n";
+    EXPECT_EQ(parse(big_head).error, 431);
+    EXPECT_EQ(parse(big_head, 100).error, 431);
+    
+    std::string big_body = "POST / HTTP/1.1\r\nContent-Length: " + std::to_string(kMaxBody + 1) + "\r\n\r\n";
+    EXPECT_EQ(parse(big_body).error, 413);
+    
+    std::string big_chunks = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n";
+    std::string chunk(64 * 1024, 'x');
+    for (size_t sent = 0; sent <= kMaxBody; sent += chunk.size()) {
+        big_chunks += "10000\r\n" + chunk + "\r\n";
+    }
+    EXPECT_EQ(parse(big_chunks).error, 413);
+}
@@ -0,0 +1,117 @@
+#include <a2a/server/http_server.hpp>
+#include <a2a/server/task_manager.hpp>
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace a2a;
+using server::HttpServer;
+using server::HttpServerOptions;
+
+namespace {
+
+// Blocking client socket whose reads give up after a few seconds
+class Client {
+public:
+    explicit Client(int port) : fd_(socket(AF_INET, SOCK_STREAM, 0)) {
+        timeval timeout{5, 0};
+        setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(static_cast<uint16_t>(port));
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        connected_ = connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+    }
+    
+    ~Client() {
+        close(fd_);
+    }
+    
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+    
+    bool connected() const { return connected_; }
+    
+    void post(const std::string& body) {
+        std::string request = "POST / HTTP/1.1\r\nHost: localhost\r\n"
+                              "Content-Type: application/json\r\n"
+                              "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+        ASSERT_EQ(send(fd_, request.data(), request.size(), MSG_NOSIGNAL),
+                  static_cast<ssize_t>(request.size()));
+    }
+    
+    // Everything received up to and including marker; empty on timeout or EOF
+    std::string read_until(const std::string& marker) {
+        char buffer[4096];
+        for (;;) {
+            size_t found = received_.find(marker);
+            if (found != std::string::npos) {
+                std::string head = received_.substr(0, found + marker.size());
+                received_.erase(0, found + marker.size());
+                return head;
+            }
+            ssize_t n = recv(fd_, buffer, sizeof(buffer), 0);
+            if (n <= 0) {
+                return std::string();
+            }
+            received_.append(buffer, static_cast<size_t>(n));
+        }
+    }
+
+private:
+    int fd_;
+    bool connected_ = false;
+    std::string received_;
+};
+
+std::string rpc(const char* method, const std::string& task_id) {
+    return std::string(R"({"jsonrpc":"2.0","id":1,"method":")") + method +
+           R"(","params":{"id":")" + task_id + R"("}})";
+}
+
+} // namespace
+
+TEST(HttpServerTest, OpenStreamsDoNotHoldWorkers) {
+    TaskManager manager;
+    AgentTask task = manager.create_task();
+    
+    HttpServerOptions options;
+    options.host = "127.0.0.1";
+    options.port = 0;
+    options.worker_threads = 2;
+    HttpServer server(options);
+    server.mount(manager);
+    server.start();
+    
+    // More open streams than workers
+    std::vector<std::unique_ptr<Client>> streams;
+    for (int i = 0; i < 6; ++i) {
+        streams.push_back(std::make_unique<Client>(server.port()));
+        ASSERT_TRUE(streams.back()->connected());
+        streams.back()->post(rpc("tasks/resubscribe", task.id()));
+        std::string first = streams.back()->read_until("\n\n");
+        ASSERT_NE(first.find("text/event-stream"), std::string::npos) << "stream " << i;
+        ASSERT_NE(first.find(task.id()), std::string::npos) << "stream " << i;
+    }
+    
+    Client client(server.port());
+    ASSERT_TRUE(client.connected());
+    client.post(rpc("tasks/get", task.id()));
+    std::string response = client.read_until(task.id());
+    EXPECT_NE(response.find("HTTP/1.1 200"), std::string::npos);
+    
+    // The final status ends every stream
+    manager.update_status(task.id(), TaskState::Completed);
+    for (auto& stream : streams) {
+        EXPECT_NE(stream->read_until("0\r\n\r\n"), "");
+    }
+    
+    server.stop();
+}
@@ -0,0 +1,53 @@
+#include <a2a/core/id_generator.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace a2a;
+
+TEST(IdGeneratorTest, FormatsUuidV7) {
+    std::string id = generate_id();
+    ASSERT_EQ(id.size(), 36u);
+    EXPECT_EQ(id[8], '-');
+    EXPECT_EQ(id[13], '-');
+    EXPECT_EQ(id[14], '7');
+    EXPECT_EQ(id[18], '-');
+    EXPECT_NE(std::string("89ab").find(id[19]), std::string::npos);
+    EXPECT_EQ(id[23], '-');
+}
+
+TEST(IdGeneratorTest, IncreasesWithinAThread) {
+    std::string previous = generate_id();
+    for (int i = 0; i < 100000; ++i) {
+        std::string id = generate_id();
+        ASSERT_LT(previous, id);
+        previous = id;
+    }
+}
+
+TEST(IdGeneratorTest, UniqueAcrossThreads) {
+    constexpr int kThreads = 8;
+    constexpr int kIds = 50000;
+    std::vector<std::vector<std::string>> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&ids, t] {
+            ids[t].reserve(kIds);
+            for (int i = 0; i < kIds; ++i) {
+                ids[t].push_back(generate_id());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    std::set<std::string> all;
+    for (const auto& list : ids) {
+        all.insert(list.begin(), list.end());
+    }
+    EXPECT_EQ(all.size(), static_cast<size_t>(kThreads) * kIds);
+}
@@ -0,0 +1,236 @@
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/json_writer.hpp>
+#include <a2a/core/wire_format.hpp>
+#include <a2a/core/exception.hpp>
+#include <a2a/models/agent_task.hpp>
+#include <a2a/models/message_send_params.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace a2a;
+
+namespace {
+
+std::string write_sample(WireFormat format) {
+    std::string out;
+    JsonWriter writer(out, format);
+    writer.begin_object();
+    writer.string_field("text", "line\n\"quoted\" \\ tab\t \x01 caf\xC3\xA9");
+    writer.integer_field("int", -1234567890123);
+    writer.key("double");
+    writer.floating(2.5);
+    writer.bool_field("yes", true);
+    writer.key("nothing");
+    writer.null();
+    writer.key("list");
+    writer.begin_array();
+    writer.integer(1);
+    writer.string("two");
+    writer.begin_object();
+    writer.end_object();
+    writer.end_array();
+    const uint8_t bytes[] = {0, 1, 2, 0xFE, 0xFF};
+    writer.key("bytes");
+    writer.bytes(bytes, sizeof(bytes));
+    writer.end_object();
+    return out;
+}
+
+void check_sample(const std::string& encoded, WireFormat format) {
+    JsonReader reader(encoded, format);
+    reader.begin_object();
+    std::string_view key;
+    std::vector<std::string> keys;
+    while (reader.next_key(key)) {
+        keys.emplace_back(key);
+        if (key == "text") {
+            EXPECT_EQ(reader.read_string(), "line\n\"quoted\" \\ tab\t \x01 caf\xC3\xA9");
+        } else if (key == "int") {
+            EXPECT_TRUE(reader.peek_integer());
+            EXPECT_EQ(reader.read_int(), -1234567890123);
+        } else if (key == "double") {
+            EXPECT_DOUBLE_EQ(reader.read_double(), 2.5);
+        } else if (key == "yes") {
+            EXPECT_TRUE(reader.read_bool());
+        } else if (key == "nothing") {
+            EXPECT_TRUE(reader.consume_null());
+        } else if (key == "list") {
+            reader.begin_array();
+            ASSERT_TRUE(reader.next_element());
+            EXPECT_EQ(reader.read_int(), 1);
+            ASSERT_TRUE(reader.next_element());
+            EXPECT_EQ(reader.read_string(), "two");
+            ASSERT_TRUE(reader.next_element());
+            EXPECT_EQ(reader.peek(), JsonReader::Type::Object);
+            reader.skip_value();
+            EXPECT_FALSE(reader.next_element());
+        } else if (key == "bytes") {
+            EXPECT_EQ(reader.read_bytes(), (std::vector<uint8_t>{0, 1, 2, 0xFE, 0xFF}));
+        } else {
+            ADD_FAILURE() << "unexpected key " << key;
+            reader.skip_value();
+        }
+    }
+    EXPECT_EQ(keys.size(), 7u);
+}
+
+void expect_parse_error(const std::string& json) {
+    try {
+        JsonReader reader(json);
+        reader.skip_value();
+        ADD_FAILURE() << "no error for " << json;
+    } catch (const A2AException& e) {
+        EXPECT_EQ(e.error_code(), ErrorCode::ParseError) << json;
+    }
+}
+
+} // namespace
+
+TEST(JsonReaderTest, RoundTripsEveryTypeAsJson) {
+    check_sample(write_sample(WireFormat::Json), WireFormat::Json);
+}
+
+TEST(JsonReaderTest, RoundTripsEveryTypeAsCbor) {
+    check_sample(write_sample(WireFormat::Cbor), WireFormat::Cbor);
+}
+
+TEST(JsonReaderTest, TranscodesBetweenFormats) {
+    std::string json = write_sample(WireFormat::Json);
+    std::string cbor = transcode(json, WireFormat::Json, WireFormat::Cbor);
+    EXPECT_EQ(transcode(cbor, WireFormat::Cbor, WireFormat::Json), json);
+}
+
+TEST(JsonReaderTest, WriterEscapesControlCharacters) {
+    std::string out;
+    JsonWriter writer(out);
+    writer.string(std::string("a\x01\x1f\"\\\n", 6));
+    EXPECT_EQ(out, "\"a\\u0001\\u001f\\\"\\\\\\n\"");
+}
+
+TEST(JsonReaderTest, DecodesUnicodeEscapes) {
+    JsonReader reader(R"(["é", "😀", "\/"])");
+    reader.begin_array();
+    ASSERT_TRUE(reader.next_element());
+    EXPECT_EQ(reader.read_string(), "\xC3\xA9");
+    ASSERT_TRUE(reader.next_element());
+    EXPECT_EQ(reader.read_string(), "\xF0\x9F\x98\x80");
+    ASSERT_TRUE(reader.next_element());
+    EXPECT_EQ(reader.read_string(), "/");
+    EXPECT_FALSE(reader.next_element());
+}
+
+TEST(JsonReaderTest, ReadRawReturnsSourceText) {
+    JsonReader reader(R"({"a": {"b": [1, "x", null]}, "c": 2})");
+    reader.begin_object();
+    std::string_view key;
+    ASSERT_TRUE(reader.next_key(key));
+    EXPECT_EQ(reader.read_raw(), R"({"b": [1, "x", null]})");
+    ASSERT_TRUE(reader.next_key(key));
+    EXPECT_EQ(key, "c");
+    EXPECT_EQ(reader.read_int(), 2);
+    EXPECT_FALSE(reader.next_key(key));
+}
+
+TEST(JsonReaderTest, RejectsMalformedInput) {
+    for (const char* json : {
+             "",
+             "{",
+             "[1, 2",
+             "{\"a\":}",
+             "{\"a\" 1}",
+             "{a: 1}",
+             "[1,,2]",
+             "\"unterminated",
+             "\"bad \\x escape\"",
+             "tru",
+             "nul",
+             "-",
+             "+1",
+             "[1 2]",
+             "{\"a\":1,}",
+             "\"bad \\u12 escape\"",
+             "[[[[",
+         }) {
+        expect_parse_error(json);
+    }
+}
+
+TEST(JsonReaderTest, SkipsWellFormedInput) {
+    std::string json = R"( {"a": [1, -2.5e3, true, false, null, "x\u00e9\n", {}, []], "b": {"c": {}}} )";
+    JsonReader reader(json);
+    reader.skip_value();
+    EXPECT_EQ(reader.mark(), json.size());
+}
+
+TEST(JsonReaderTest, RejectsDeepNesting) {
+    expect_parse_error(std::string(10000, '['));
+}
+
+TEST(JsonReaderTest, RejectsTruncatedCbor) {
+    std::string cbor = write_sample(WireFormat::Cbor);
+    for (size_t length = 0; length < cbor.size(); ++length) {
+        std::string truncated = cbor.substr(0, length);
+        EXPECT_THROW({
+            JsonReader reader(truncated, WireFormat::Cbor);
+            reader.skip_value();
+        }, A2AException) << "length " << length;
+    }
+}
+
+TEST(JsonReaderTest, StringMapRoundTrip) {
+    std::map<std::string, std::string> metadata{{"k", "v \"q\""}, {"empty", ""}};
+    std::string out;
+    JsonWriter writer(out);
+    writer.string_map(metadata);
+    
+    std::map<std::string, std::string> back;
+    JsonReader reader(out);
+    reader.read_string_map(back);
+    EXPECT_EQ(back, metadata);
+}
+
+TEST(JsonReaderTest, StringMapRejectsNonStringValues) {
+    for (const char* json : {R"({"n": 1})", R"({"b": true})", R"({"o": {}})", R"({"z": null})"}) {
+        std::map<std::string, std::string> out;
+        JsonReader reader(json);
+        try {
+            reader.read_string_map(out);
+            ADD_FAILURE() << "no error for " << json;
+        } catch (const A2AException& e) {
+            EXPECT_EQ(e.error_code(), ErrorCode::InvalidParams) << json;
+        }
+    }
+}
+
+TEST(JsonReaderTest, TaskRoundTrip) {
+    AgentTask task("task-1", "context-1");
+    task.set_status(AgentTaskStatus(TaskState::Running));
+    task.add_metadata("owner", "tests");
+    task.add_artifact(Artifact("artifact-1", "result").with_content("42"));
+    task.add_history_message(AgentMessage::create()
+                                 .with_message_id("m1")
+                                 .with_role(MessageRole::User)
+                                 .with_text("hello \"world\""));
+    
+    std::string json = task.to_json();
+    AgentTask back = AgentTask::from_json(json);
+    EXPECT_EQ(back.id(), "task-1");
+    EXPECT_EQ(back.context_id(), "context-1");
+    EXPECT_EQ(back.status().state(), TaskState::Running);
+    EXPECT_EQ(back.metadata().at("owner"), "tests");
+    ASSERT_EQ(back.artifacts().size(), 1u);
+    ASSERT_EQ(back.history().size(), 1u);
+    EXPECT_EQ(back.history()[0].get_text(), "hello \"world\"");
+    EXPECT_EQ(back.to_json(), json);
+}
+
+TEST(JsonReaderTest, QueryParamsRejectNonStringMetadata) {
+    try {
+        TaskQueryParams::from_json(R"({"id":"t","metadata":{"n":1}})");
+        ADD_FAILURE() << "no error";
+    } catch (const A2AException& e) {
+        EXPECT_EQ(e.error_code(), ErrorCode::InvalidParams);
+    }
+}
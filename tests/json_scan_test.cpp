@@ -0,0 +1,70 @@
+#include "core/json_scan.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace a2a;
+
+namespace {
+
+size_t naive_find_special(const std::string& s) {
+    for (size_t i = 0; i < s.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        if (c == '"' || c == '\\' || c < 0x20) {
+            return i;
+        }
+    }
+    return s.size();
+}
+
+} // namespace
+
+// The vector loops handle 16 or 32 bytes per step; every special byte at
+// every offset, across the block and tail boundaries, must be found
+TEST(JsonScanTest, FindsSpecialAtEveryOffset) {
+    for (size_t size = 0; size <= 100; ++size) {
+        std::string clean(size, 'a');
+        EXPECT_EQ(find_json_special(clean.data(), clean.size()), size);
+        
+        for (size_t at = 0; at < size; ++at) {
+            for (char special : {'"', '\\', '\n', '\x1f', '\0'}) {
+                std::string s = clean;
+                s[at] = special;
+                // High bytes (UTF-8) are not special
+                if (at + 1 < size) {
+                    s[at + 1] = '\xC3';
+                }
+                ASSERT_EQ(find_json_special(s.data(), s.size()), naive_find_special(s))
+                    << "size " << size << " at " << at;
+            }
+        }
+    }
+}
+
+TEST(JsonScanTest, IgnoresBytesAboveAscii) {
+    std::string s(64, '\xE9');
+    EXPECT_EQ(find_json_special(s.data(), s.size()), s.size());
+    s[40] = ' ';
+    s[41] = 0x7F;
+    EXPECT_EQ(find_json_special(s.data(), s.size()), s.size());
+}
+
+TEST(JsonScanTest, ValidatesUtf8) {
+    auto valid = [](const std::string& s) { return is_valid_utf8(s.data(), s.size()); };
+    EXPECT_TRUE(valid(""));
+    EXPECT_TRUE(valid("plain ascii"));
+    EXPECT_TRUE(valid("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80"));
+    EXPECT_TRUE(valid("\xF4\x8F\xBF\xBF"));         // U+10FFFF
+    EXPECT_FALSE(valid("\xC0\xAF"));                // overlong '/'
+    EXPECT_FALSE(valid("\xE0\x80\xAF"));            // overlong
+    EXPECT_FALSE(valid("\xED\xA0\x80"));            // surrogate
+    EXPECT_FALSE(valid("\xF4\x90\x80\x80"));        // above U+10FFFF
+    EXPECT_FALSE(valid("\xC3"));                    // truncated
+    EXPECT_FALSE(valid("\x80"));                    // stray continuation
+    EXPECT_FALSE(valid(std::string(40, 'a') + "\xFF" + std::string(40, 'a')));
+}
+
+TEST(JsonScanTest, ReplacesInvalidSequences) {
+    std::string out;
+    append_utf8_replacing_invalid(out, "a\xFF" "b\xC3\xA9");
+    EXPECT_EQ(out, "a\xEF\xBF\xBD" "b\xC3\xA9");
+}
@@ -0,0 +1,167 @@
+#include <a2a/server/jsonrpc_dispatcher.hpp>
+#include <a2a/server/task_manager.hpp>
+#include <a2a/core/json_reader.hpp>
+#include <a2a/core/exception.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace a2a;
+using server::JsonRpcDispatcher;
+
+namespace {
+
+struct Response {
+    std::string id;      // raw JSON
+    std::string result;  // raw JSON, empty on error
+    int error_code = 0;
+};
+
+Response read_response(JsonReader& reader) {
+    Response response;
+    reader.begin_object();
+    std::string_view key;
+    while (reader.next_key(key)) {
+        if (key == "id") {
+            response.id = std::string(reader.read_raw());
+        } else if (key == "result") {
+            response.result = std::string(reader.read_raw());
+        } else if (key == "error") {
+            reader.begin_object();
+            std::string_view error_key;
+            while (reader.next_key(error_key)) {
+                if (error_key == "code") {
+                    response.error_code = static_cast<int>(reader.read_int());
+                } else {
+                    reader.skip_value();
+                }
+            }
+        } else {
+            reader.skip_value();
+        }
+    }
+    return response;
+}
+
+Response parse_single(const std::string& body) {
+    JsonReader reader(body);
+    return read_response(reader);
+}
+
+std::vector<Response> parse_batch(const std::string& body) {
+    std::vector<Response> responses;
+    JsonReader reader(body);
+    reader.begin_array();
+    while (reader.next_element()) {
+        responses.push_back(read_response(reader));
+    }
+    return responses;
+}
+
+class JsonRpcDispatcherTest : public ::testing::Test {
+protected:
+    JsonRpcDispatcherTest() : dispatcher_(4) {
+        dispatcher_.register_method("echo", [](std::string_view params) {
+            return std::string(params.empty() ? "null" : params);
+        });
+        dispatcher_.register_method("fail", [](std::string_view) -> std::string {
+            throw A2AException("no", ErrorCode::InvalidParams);
+        });
+    }
+    
+    JsonRpcDispatcher dispatcher_;
+};
+
+} // namespace
+
+TEST_F(JsonRpcDispatcherTest, EchoesParamsAndIdType) {
+    Response response = parse_single(dispatcher_.dispatch(
+        R"({"jsonrpc":"2.0","id":7,"method":"echo","params":{"a":[1,2]}})"));
+    EXPECT_EQ(response.id, "7");
+    EXPECT_EQ(response.result, R"({"a":[1,2]})");
+    
+    response = parse_single(dispatcher_.dispatch(R"({"jsonrpc":"2.0","id":"x","method":"echo"})"));
+    EXPECT_EQ(response.id, "\"x\"");
+}
+
+TEST_F(JsonRpcDispatcherTest, ReportsErrors) {
+    EXPECT_EQ(parse_single(dispatcher_.dispatch("{not json")).error_code, -32700);
+    EXPECT_EQ(parse_single(dispatcher_.dispatch(R"({"jsonrpc":"2.0","id":1,"method":"nope"})")).error_code,
+              -32601);
+    EXPECT_EQ(parse_single(dispatcher_.dispatch(R"({"jsonrpc":"2.0","id":1,"method":"fail"})")).error_code,
+              -32602);
+    EXPECT_EQ(parse_single(dispatcher_.dispatch("[]")).error_code, -32600);
+}
+
+TEST_F(JsonRpcDispatcherTest, AnswersBatchInRequestOrder) {
+    std::string body = "[";
+    for (int i = 0; i < 20; ++i) {
+        body += (i ? "," : "");
+        body += R"({"jsonrpc":"2.0","id":)" + std::to_string(i) +
+                R"(,"method":")" + (i % 5 == 4 ? "fail" : "echo") + R"(","params":[)" +
+                std::to_string(i) + "]}";
+    }
+    body += R"(,{"jsonrpc":"2.0","method":"echo","params":[99]}])";
+    
+    auto responses = parse_batch(dispatcher_.dispatch(body));
+    ASSERT_EQ(responses.size(), 20u);  // the notification gets no response
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(responses[i].id, std::to_string(i));
+        if (i % 5 == 4) {
+            EXPECT_EQ(responses[i].error_code, -32602);
+        } else {
+            EXPECT_EQ(responses[i].result, "[" + std::to_string(i) + "]");
+        }
+    }
+}
+
+TEST_F(JsonRpcDispatcherTest, NotificationsOnlyGetNoResponse) {
+    EXPECT_EQ(dispatcher_.dispatch(R"({"jsonrpc":"2.0","method":"echo"})"), "");
+    EXPECT_EQ(dispatcher_.dispatch(R"([{"jsonrpc":"2.0","method":"echo"},{"jsonrpc":"2.0","method":"echo"}])"), "");
+}
+
+TEST_F(JsonRpcDispatcherTest, RunsBatchMembersConcurrently) {
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+    dispatcher_.register_method("slow", [&](std::string_view) {
+        int now = ++running;
+        int seen = peak.load();
+        while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        --running;
+        return std::string("true");
+    });
+    
+    std::string body = "[";
+    for (int i = 0; i < 4; ++i) {
+        body += (i ? "," : "");
+        body += R"({"jsonrpc":"2.0","id":)" + std::to_string(i) + R"(,"method":"slow"})";
+    }
+    body += "]";
+    EXPECT_EQ(parse_batch(dispatcher_.dispatch(body)).size(), 4u);
+    EXPECT_GT(peak.load(), 1);
+}
+
+TEST_F(JsonRpcDispatcherTest, ServesTaskManagerMethods) {
+    TaskManager task_manager;
+    task_manager.set_on_message_received([](const MessageSendParams& params) {
+        return A2AResponse(AgentMessage::create()
+                               .with_role(MessageRole::Agent)
+                               .with_text("Echo: " + params.message().get_text()));
+    });
+    dispatcher_.register_task_manager(task_manager);
+    
+    Response response = parse_single(dispatcher_.dispatch(
+        R"({"jsonrpc":"2.0","id":1,"method":"message/send","params":{"message":)"
+        R"({"role":"user","parts":[{"kind":"text","text":"hi"}],"messageId":"m1"}}})"));
+    ASSERT_EQ(response.error_code, 0);
+    EXPECT_NE(response.result.find("Echo: hi"), std::string::npos);
+    
+    response = parse_single(dispatcher_.dispatch(
+        R"({"jsonrpc":"2.0","id":2,"method":"tasks/get","params":{"id":"missing"}})"));
+    EXPECT_NE(response.error_code, 0);
+}
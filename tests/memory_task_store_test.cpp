@@ -0,0 +1,219 @@
+#include <a2a/server/memory_task_store.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace a2a;
+
+namespace {
+
+AgentMessage text_message(const std::string& text) {
+    return AgentMessage::create().with_role(MessageRole::User).with_text(text);
+}
+
+MemoryTaskStoreOptions single_shard() {
+    MemoryTaskStoreOptions options;
+    options.shard_count = 1;
+    return options;
+}
+
+} // namespace
+
+TEST(MemoryTaskStoreTest, StoresAndUpdatesTasks) {
+    MemoryTaskStore store;
+    store.set_task(AgentTask("t", "c"));
+    ASSERT_TRUE(store.task_exists("t"));
+    
+    store.update_status("t", TaskState::Running, "working");
+    store.add_artifact("t", Artifact("a", "result"));
+    store.add_history_message("t", text_message("one"));
+    
+    auto task = store.get_task("t");
+    ASSERT_TRUE(task.has_value());
+    EXPECT_EQ(task->status().state(), TaskState::Running);
+    EXPECT_EQ(task->artifacts().size(), 1u);
+    EXPECT_EQ(task->history().size(), 1u);
+    
+    EXPECT_TRUE(store.delete_task("t"));
+    EXPECT_FALSE(store.delete_task("t"));
+    EXPECT_FALSE(store.get_task("t").has_value());
+    EXPECT_EQ(store.size(), 0u);
+    EXPECT_EQ(store.bytes(), 0u);
+}
+
+TEST(MemoryTaskStoreTest, SnapshotsAreNotChangedByLaterWrites) {
+    MemoryTaskStore store;
+    store.set_task(AgentTask("t", "c"));
+    auto before = store.get_task_snapshot("t");
+    
+    store.update_status("t", TaskState::Completed);
+    store.add_history_message("t", text_message("later"));
+    
+    EXPECT_EQ(before->status().state(), TaskState::Submitted);
+    EXPECT_TRUE(before->history().empty());
+    auto after = store.get_task_snapshot("t");
+    EXPECT_EQ(after->status().state(), TaskState::Completed);
+    EXPECT_EQ(after->history().size(), 1u);
+}
+
+// Readers hold snapshots while writers update the same tasks; meant to be
+// run under ThreadSanitizer as well
+TEST(MemoryTaskStoreTest, ConcurrentSnapshotsAndWrites) {
+    MemoryTaskStore store;
+    for (int i = 0; i < 8; ++i) {
+        store.set_task(AgentTask("t" + std::to_string(i), "c"));
+    }
+    
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int w = 0; w < 4; ++w) {
+        threads.emplace_back([&store, w] {
+            for (int k = 0; k < 2000; ++k) {
+                std::string id = "t" + std::to_string((w + k) % 8);
+                store.add_history_message(id, text_message(std::to_string(k)));
+            }
+        });
+    }
+    for (int r = 0; r < 4; ++r) {
+        threads.emplace_back([&store, &done, r] {
+            while (!done) {
+                auto task = store.get_task_snapshot("t" + std::to_string(r));
+                size_t size = task->history().size();
+                size_t counted = 0;
+                for (const auto& message : task->history()) {
+                    counted += message.get_text().empty() ? 0 : 1;
+                }
+                ASSERT_EQ(counted, size);
+            }
+        });
+    }
+    for (int w = 0; w < 4; ++w) {
+        threads[w].join();
+    }
+    done = true;
+    for (size_t i = 4; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    
+    size_t total = 0;
+    for (int i = 0; i < 8; ++i) {
+        total += store.get_task_snapshot("t" + std::to_string(i))->history().size();
+    }
+    EXPECT_EQ(total, 4u * 2000u);
+}
+
+TEST(MemoryTaskStoreTest, EvictsLeastRecentlyUsedTasks) {
+    MemoryTaskStoreOptions options = single_shard();
+    options.max_tasks = 3;
+    MemoryTaskStore store(options);
+    
+    store.set_task(AgentTask("a", "c"));
+    store.set_task(AgentTask("b", "c"));
+    store.set_task(AgentTask("c", "c"));
+    ASSERT_TRUE(store.get_task_snapshot("a"));  // a is now the most recent
+    store.set_task(AgentTask("d", "c"));
+    
+    EXPECT_EQ(store.size(), 3u);
+    EXPECT_TRUE(store.task_exists("a"));
+    EXPECT_FALSE(store.task_exists("b"));
+    EXPECT_TRUE(store.task_exists("c"));
+    EXPECT_TRUE(store.task_exists("d"));
+}
+
+TEST(MemoryTaskStoreTest, StaysWithinByteBudget) {
+    MemoryTaskStoreOptions options = single_shard();
+    options.max_bytes = 64 * 1024;
+    MemoryTaskStore store(options);
+    
+    for (int i = 0; i < 200; ++i) {
+        std::string id = "t" + std::to_string(i);
+        store.set_task(AgentTask(id, "c"));
+        store.add_history_message(id, text_message(std::string(1024, 'x')));
+        ASSERT_LE(store.bytes(), options.max_bytes);
+    }
+    EXPECT_TRUE(store.task_exists("t199"));
+    EXPECT_FALSE(store.task_exists("t0"));
+}
+
+TEST(MemoryTaskStoreTest, RemovesTerminalTasksAfterTtl) {
+    MemoryTaskStoreOptions options = single_shard();
+    options.terminal_ttl = std::chrono::milliseconds(50);
+    options.reap_interval = std::chrono::hours(1);  // only remove_expired()
+    MemoryTaskStore store(options);
+    
+    store.set_task(AgentTask("done", "c"));
+    store.set_task(AgentTask("running", "c"));
+    store.set_task(AgentTask("revived", "c"));
+    store.update_status("done", TaskState::Completed);
+    store.update_status("running", TaskState::Running);
+    store.update_status("revived", TaskState::Failed);
+    
+    EXPECT_EQ(store.remove_expired(), 0u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    store.update_status("revived", TaskState::Running);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    
+    EXPECT_EQ(store.remove_expired(), 1u);
+    EXPECT_FALSE(store.task_exists("done"));
+    EXPECT_TRUE(store.task_exists("running"));
+    EXPECT_TRUE(store.task_exists("revived"));
+}
+
+TEST(MemoryTaskStoreTest, ReaperRemovesExpiredTasks) {
+    MemoryTaskStoreOptions options = single_shard();
+    options.terminal_ttl = std::chrono::milliseconds(10);
+    options.reap_interval = std::chrono::milliseconds(10);
+    MemoryTaskStore store(options);
+    
+    store.set_task(AgentTask("t", "c"));
+    store.update_status("t", TaskState::Completed);
+    for (int i = 0; i < 200 && store.task_exists("t"); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_FALSE(store.task_exists("t"));
+}
+
+TEST(MemoryTaskStoreTest, CapsHistory) {
+    MemoryTaskStoreOptions options;
+    options.max_history = 2;
+    MemoryTaskStore store(options);
+    store.set_task(AgentTask("t", "c"));
+    for (int i = 0; i < 5; ++i) {
+        store.add_history_message("t", text_message(std::to_string(i)));
+    }
+    
+    auto tail = store.get_history_tail("t");
+    ASSERT_EQ(tail.size(), 2u);
+    EXPECT_EQ(tail[0]->get_text(), "3");
+    EXPECT_EQ(tail[1]->get_text(), "4");
+    EXPECT_EQ(store.get_history("t", 1).at(0).get_text(), "4");
+}
+
+TEST(MemoryTaskStoreTest, StoredTasksOutliveTheParsingArena) {
+    AgentTask original("t", "c");
+    original.add_history_message(text_message("parsed"));
+    std::string json = original.to_json();
+    
+    MemoryTaskStore store;
+    {
+        auto arena = std::make_unique<std::pmr::monotonic_buffer_resource>();
+        AgentTask task = AgentTask::from_json(json, arena.get());
+        task.add_history_message(AgentMessage(text_message("moved"), arena.get()));
+        store.set_task(task);
+        // The arena is on the heap so that a sanitizer flags reads after it is freed
+    }
+    
+    auto stored = store.get_task("t");
+    ASSERT_TRUE(stored.has_value());
+    ASSERT_EQ(stored->history().size(), 2u);
+    for (const auto& message : stored->history()) {
+        EXPECT_EQ(message.resource(), std::pmr::get_default_resource());
+    }
+    EXPECT_EQ(stored->history()[0].get_text(), "parsed");
+    EXPECT_EQ(stored->history()[1].get_text(), "moved");
+}
@@ -0,0 +1,107 @@
+#include <a2a/models/message_history.hpp>
+#include <a2a/models/agent_task.hpp>
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+#include <string>
+
+using namespace a2a;
+
+namespace {
+
+AgentMessage text_message(const std::string& text) {
+    return AgentMessage::create().with_role(MessageRole::User).with_text(text);
+}
+
+} // namespace
+
+TEST(MessageHistoryTest, KeepsNewestWithinCapacity) {
+    MessageHistory history(3);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(history.push_back(text_message(std::to_string(i))), static_cast<uint64_t>(i));
+    }
+    ASSERT_EQ(history.size(), 3u);
+    EXPECT_EQ(history.front().get_text(), "2");
+    EXPECT_EQ(history.back().get_text(), "4");
+    EXPECT_EQ(history.first_sequence(), 2u);
+    EXPECT_EQ(history.next_sequence(), 5u);
+    
+    auto range = history.range(0, 2);
+    ASSERT_EQ(range.size(), 2u);
+    EXPECT_EQ(range[0]->get_text(), "2");
+    EXPECT_EQ(history.range(4).size(), 1u);
+    EXPECT_TRUE(history.range(5).empty());
+}
+
+TEST(MessageHistoryTest, CopiesShareMessages) {
+    MessageHistory history;
+    history.push_back(text_message("shared"));
+    MessageHistory copy = history;
+    EXPECT_EQ(copy.ptr(0).get(), history.ptr(0).get());
+    
+    copy.push_back(text_message("only in copy"));
+    EXPECT_EQ(history.size(), 1u);
+    EXPECT_EQ(copy.size(), 2u);
+}
+
+// Random operations against a deque of the same messages
+TEST(MessageHistoryTest, MatchesDequeModel) {
+    std::mt19937 rng(7);
+    for (int round = 0; round < 50; ++round) {
+        size_t capacity = rng() % 2 ? rng() % 12 : 0;
+        MessageHistory history(capacity);
+        std::deque<std::string> model;
+        uint64_t next = 0;
+        
+        for (int step = 0; step < 400; ++step) {
+            switch (rng() % 10) {
+                case 0: {
+                    size_t max = rng() % 10;
+                    history.trim(max);
+                    while (model.size() > max) model.pop_front();
+                    break;
+                }
+                case 1:
+                    capacity = rng() % 12;
+                    history.set_capacity(capacity);
+                    while (capacity != 0 && model.size() > capacity) model.pop_front();
+                    break;
+                case 2:
+                    if (rng() % 8 == 0) {
+                        history.clear();
+                        model.clear();
+                    }
+                    break;
+                default: {
+                    std::string text = std::to_string(next);
+                    ASSERT_EQ(history.push_back(text_message(text)), next);
+                    ++next;
+                    model.push_back(text);
+                    if (capacity != 0 && model.size() > capacity) model.pop_front();
+                }
+            }
+            
+            ASSERT_EQ(history.size(), model.size());
+            ASSERT_EQ(history.next_sequence(), next);
+            ASSERT_EQ(history.first_sequence(), next - model.size());
+            size_t i = 0;
+            for (const auto& message : history) {
+                ASSERT_EQ(message.get_text(), model[i++]);
+            }
+            size_t count = rng() % 6;
+            auto tail = history.tail(count);
+            size_t expected = count == 0 || count > model.size() ? model.size() : count;
+            ASSERT_EQ(tail.size(), expected);
+            for (size_t k = 0; k < expected; ++k) {
+                ASSERT_EQ(tail[k]->get_text(), model[model.size() - expected + k]);
+            }
+        }
+    }
+}
+
+TEST(MessageHistoryTest, TaskCopySharesHistory) {
+    AgentTask task("t", "c");
+    task.add_history_message(text_message("one"));
+    AgentTask copy = task;
+    EXPECT_EQ(copy.history().ptr(0).get(), task.history().ptr(0).get());
+}
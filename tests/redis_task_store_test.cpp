@@ -0,0 +1,172 @@
+#include <a2a/server/redis_task_store.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace a2a;
+
+namespace {
+
+// Each test uses its own key prefix so runs never see each other's tasks
+RedisTaskStoreOptions test_options(const std::string& test) {
+    RedisTaskStoreOptions options;
+    std::string address = std::getenv("A2A_TEST_REDIS");
+    size_t colon = address.rfind(':');
+    if (colon != std::string::npos) {
+        options.port = std::stoi(address.substr(colon + 1));
+        address.resize(colon);
+    }
+    options.host = address;
+    options.key_prefix = "a2a-test:" + test + ":" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ":";
+    return options;
+}
+
+class RedisTaskStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!std::getenv("A2A_TEST_REDIS")) {
+            GTEST_SKIP() << "A2A_TEST_REDIS is not set";
+        }
+    }
+    
+    RedisTaskStoreOptions options() const {
+        return test_options(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    }
+};
+
+AgentTask make_task(const std::string& id, int messages) {
+    AgentTask task(id, "context-" + id);
+    task.set_status(AgentTaskStatus(TaskState::Running));
+    task.add_metadata("quote", "v\"1");
+    task.add_artifact(Artifact("artifact-1", "result").with_content("42"));
+    for (int i = 0; i < messages; ++i) {
+        task.add_history_message(AgentMessage::create().with_text("m" + std::to_string(i)));
+    }
+    return task;
+}
+
+} // namespace
+
+TEST_F(RedisTaskStoreTest, MissingTask) {
+    RedisTaskStore store(options());
+    EXPECT_FALSE(store.get_task("missing").has_value());
+    EXPECT_FALSE(store.task_exists("missing"));
+    EXPECT_FALSE(store.delete_task("missing"));
+    
+    // Updating a task that does not exist must not create it
+    store.update_status("missing", TaskState::Completed);
+    EXPECT_FALSE(store.task_exists("missing"));
+}
+
+TEST_F(RedisTaskStoreTest, RoundTrip) {
+    RedisTaskStore store(options());
+    AgentTask task = make_task("t1", 2);
+    store.set_task(task);
+    
+    auto stored = store.get_task("t1");
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_EQ(stored->to_json(), task.to_json());
+    EXPECT_TRUE(store.task_exists("t1"));
+}
+
+TEST_F(RedisTaskStoreTest, IncrementalUpdates) {
+    RedisTaskStore store(options());
+    store.set_task(make_task("t1", 1));
+    
+    store.update_status("t1", TaskState::Failed, "boom");
+    store.add_artifact("t1", Artifact("artifact-2", "second"));
+    store.add_history_message("t1", AgentMessage::create().with_text("late"));
+    
+    auto stored = store.get_task("t1");
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_EQ(stored->status().state(), TaskState::Failed);
+    EXPECT_EQ(stored->status().message(), "boom");
+    EXPECT_EQ(stored->artifacts().size(), 2u);
+    ASSERT_EQ(stored->history().size(), 2u);
+    EXPECT_EQ(stored->history()[1].get_text(), "late");
+}
+
+TEST_F(RedisTaskStoreTest, HistoryIsCapped) {
+    RedisTaskStoreOptions opts = options();
+    opts.max_history = 3;
+    RedisTaskStore store(opts);
+    store.set_task(make_task("t1", 5));
+    store.add_history_message("t1", AgentMessage::create().with_text("m5"));
+    
+    auto stored = store.get_task("t1");
+    ASSERT_TRUE(stored.has_value());
+    ASSERT_EQ(stored->history().size(), 3u);
+    EXPECT_EQ(stored->history()[0].get_text(), "m3");
+    EXPECT_EQ(stored->history()[2].get_text(), "m5");
+    
+    auto recent = store.get_history("t1", 2);
+    ASSERT_EQ(recent.size(), 2u);
+    EXPECT_EQ(recent[0].get_text(), "m4");
+    EXPECT_EQ(recent[1].get_text(), "m5");
+}
+
+TEST_F(RedisTaskStoreTest, AsyncCallsOnOneTaskApplyInOrder) {
+    RedisTaskStore store(options());
+    store.set_task_async(make_task("t1", 0)).get();
+    
+    std::vector<std::future<void>> pending;
+    for (int i = 0; i < 100; ++i) {
+        pending.push_back(store.add_history_message_async(
+            "t1", AgentMessage::create().with_text(std::to_string(i))));
+    }
+    pending.push_back(store.update_status_async("t1", TaskState::Completed));
+    auto read = store.get_task_async("t1");
+    for (auto& f : pending) {
+        f.get();
+    }
+    
+    auto stored = read.get();
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_EQ(stored->status().state(), TaskState::Completed);
+    ASSERT_EQ(stored->history().size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(stored->history()[i].get_text(), std::to_string(i));
+    }
+}
+
+TEST_F(RedisTaskStoreTest, DeleteRemovesTask) {
+    RedisTaskStore store(options());
+    store.set_task(make_task("t1", 1));
+    EXPECT_TRUE(store.delete_task("t1"));
+    EXPECT_FALSE(store.delete_task("t1"));
+    EXPECT_FALSE(store.task_exists("t1"));
+    EXPECT_TRUE(store.get_history("t1").empty());
+}
+
+TEST_F(RedisTaskStoreTest, PublishesChanges) {
+    RedisTaskStoreOptions opts = options();
+    opts.publish_changes = true;
+    RedisTaskStore writer(opts);
+    RedisTaskStore watcher(opts);
+    
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::string> ids;
+    watcher.subscribe_changes([&](const std::string& task_id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.push_back(task_id);
+        changed.notify_all();
+    });
+    
+    // The subscription is set up asynchronously; write until it is heard
+    auto heard = [&] { return std::find(ids.begin(), ids.end(), "t1") != ids.end(); };
+    std::unique_lock<std::mutex> lock(mutex);
+    for (int attempt = 0; attempt < 50 && !heard(); ++attempt) {
+        lock.unlock();
+        writer.set_task(make_task("t1", 0));
+        lock.lock();
+        changed.wait_for(lock, std::chrono::milliseconds(100), heard);
+    }
+    EXPECT_TRUE(heard());
+}
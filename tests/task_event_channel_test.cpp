@@ -0,0 +1,112 @@
+#include "server/task_event_channel.hpp"
+#include <a2a/server/task_manager.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace a2a;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Kind = TaskEventChannel::Kind;
+using Result = TaskEventChannel::Result;
+
+} // namespace
+
+TEST(TaskEventChannelTest, CoalescesStatusUpdates) {
+    TaskEventChannel channel(1, 10ms);
+    channel.publish("t", "running", Kind::Status, false);
+    std::thread producer([&] {
+        channel.publish("t", "working", Kind::Status, false);
+        channel.publish("t", "done", Kind::Status, true);
+    });
+    producer.join();
+    
+    std::string task_id, event;
+    bool final = false;
+    ASSERT_EQ(channel.next(task_id, event, final, 0ms), Result::Event);
+    EXPECT_EQ(event, "done");
+    EXPECT_TRUE(final);
+    EXPECT_EQ(channel.next(task_id, event, final, 0ms), Result::Timeout);
+}
+
+TEST(TaskEventChannelTest, ProducerWaitsForAConsumerThatKeepsUp) {
+    TaskEventChannel channel(1, 5s);
+    std::thread producer([&] {
+        for (int i = 0; i < 100; ++i) {
+            channel.publish("t", std::to_string(i), Kind::Artifact, false);
+        }
+    });
+    
+    std::string task_id, event;
+    bool final = false;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(channel.next(task_id, event, final, 5s), Result::Event);
+        EXPECT_EQ(event, std::to_string(i));
+    }
+    producer.join();
+}
+
+TEST(TaskEventChannelTest, ClosesALaggingChannel) {
+    TaskEventChannel channel(2, 20ms);
+    std::thread producer([&] {
+        for (int i = 0; i < 10; ++i) {
+            channel.publish("t", std::to_string(i), Kind::Artifact, false);
+        }
+    });
+    producer.join();
+    
+    // What was queued is still delivered, then the stream ends
+    std::string task_id, event;
+    bool final = false;
+    ASSERT_EQ(channel.next(task_id, event, final, 0ms), Result::Event);
+    EXPECT_EQ(event, "0");
+    ASSERT_EQ(channel.next(task_id, event, final, 0ms), Result::Event);
+    EXPECT_EQ(event, "1");
+    EXPECT_EQ(channel.next(task_id, event, final, 0ms), Result::Closed);
+}
+
+TEST(TaskEventChannelTest, StalledStreamDoesNotBlockTaskUpdates) {
+    TaskManager manager;
+    TaskStreamOptions options;
+    options.max_queued_events = 2;
+    options.max_publish_wait = 20ms;
+    manager.set_stream_options(options);
+    AgentTask task = manager.create_task();
+    
+    // The subscriber stops reading after the task snapshot
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool subscribed = false;
+    bool release = false;
+    std::thread subscriber([&] {
+        manager.resubscribe(task.id(), [&](const std::string&) {
+            std::unique_lock<std::mutex> lock(mutex);
+            subscribed = true;
+            cv.notify_all();
+            cv.wait(lock, [&] { return release; });
+        });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return subscribed; });
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 20; ++i) {
+        manager.return_artifact(task.id(), Artifact("a" + std::to_string(i), "chunk"));
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+    
+    // The lagging stream ends without waiting for the task to finish
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    subscriber.join();
+}
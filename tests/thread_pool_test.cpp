@@ -0,0 +1,58 @@
+#include "server/thread_pool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace a2a::server;
+
+TEST(GrowingThreadPoolTest, RunsEveryJobAtOnce) {
+    GrowingThreadPool pool;
+    std::mutex mutex;
+    std::condition_variable cv;
+    int started = 0;
+    bool release = false;
+    
+    // Each job waits for all the others, so this only ends if all run together
+    constexpr int kJobs = 32;
+    for (int i = 0; i < kJobs; ++i) {
+        pool.submit([&] {
+            std::unique_lock<std::mutex> lock(mutex);
+            ++started;
+            cv.notify_all();
+            cv.wait(lock, [&] { return release; });
+        });
+    }
+    
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(10), [&] { return started == kJobs; }));
+    EXPECT_GE(pool.size(), static_cast<size_t>(kJobs));
+    release = true;
+    cv.notify_all();
+}
+
+TEST(GrowingThreadPoolTest, RetiresIdleThreads) {
+    GrowingThreadPool pool(std::chrono::milliseconds(50));
+    std::atomic<int> done{0};
+    for (int i = 0; i < 100; ++i) {
+        pool.submit([&] { ++done; });
+        while (done.load() <= i) {
+            std::this_thread::yield();
+        }
+    }
+    EXPECT_GE(pool.size(), 1u);
+    
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (pool.size() != 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(pool.size(), 0u);
+    
+    // A retired pool still takes work
+    pool.submit([&] { ++done; });
+    while (done.load() != 101) {
+        std::this_thread::yield();
+    }
+}